@@ -0,0 +1,126 @@
+/*
+ * BondPricingBenchmark
+ *
+ * Throughput of the analytic bond pricing, in trades per second:
+ *   - the BondAnalytics yield solver on each instruction set, and
+ *   - the bond engines pricing the BondTrades.dat book, repeated up to the
+ *     requested size, with their simulated latency switched off so the run
+ *     is bound by compute alone.
+ *
+ * Build with optimisations and run from the build directory:
+ *   cmake -DCMAKE_BUILD_TYPE=Release .. && make BondPricingBenchmark
+ *   ./BondPricingBenchmark [trades]
+ */
+
+#include "../Loaders/BondTradeLoader.h"
+#include "../Models/BondTrade.h"
+#include "../Models/ResultBatch.h"
+#include "../Pricers/BondAnalytics.h"
+#include "../Pricers/CorpBondPricingEngine.h"
+#include "../Pricers/GovBondPricingEngine.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr int Repeats = 5;
+
+    template <typename F>
+    void run(const std::string& name, std::size_t trades, F&& body) {
+        double best = 1e300;
+        for (int r = 0; r < Repeats; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        std::cout << std::left << std::setw(32) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2) << best * 1000.0 << " ms"
+                  << std::setw(14) << std::setprecision(0) << trades / best << " trades/s" << std::endl;
+    }
+
+    // Forwards to the engine's public IPricingEngine interface.
+    void priceBatch(IPricingEngine& engine, const std::vector<ITrade*>& trades, ResultBatch& results) {
+        results.clear();
+        engine.priceBatch(trades, &results);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t trades = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    BondTradeLoader loader;
+    loader.setDataFile("TradeData/BondTrades.dat");
+    std::vector<ITrade*> sample = loader.loadTrades();
+    if (sample.empty()) {
+        std::cerr << "No trades in TradeData/BondTrades.dat; run from the build directory" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<BondTrade>> book;
+    std::vector<ITrade*> govTrades;
+    std::vector<ITrade*> corpTrades;
+    book.reserve(trades);
+    for (std::size_t i = 0; i < trades; ++i) {
+        const ITrade& source = *sample[i % sample.size()];
+        book.push_back(std::make_unique<BondTrade>(source.getTradeId() + "-" + std::to_string(i), source.getTradeType()));
+        book.back()->setNotional(source.getNotional());
+        book.back()->setRate(source.getRate());
+        (source.getTradeType() == BondTrade::GovBondTradeType ? govTrades : corpTrades).push_back(book.back().get());
+    }
+    for (ITrade* trade : sample) {
+        delete trade;
+    }
+
+    std::cout << trades << " trades from " << sample.size() << " in BondTrades.dat, best of "
+              << Repeats << " runs" << std::endl;
+    std::cout << "Detected instruction set: " << BondAnalytics::isaName(BondAnalytics::detectIsa())
+              << std::endl << std::endl;
+
+    std::vector<double> prices;
+    std::vector<double> notionals;
+    for (ITrade* trade : govTrades) {
+        prices.push_back(trade->getRate());
+        notionals.push_back(trade->getNotional());
+    }
+    std::vector<BondAnalytics::Result> results(prices.size());
+
+    std::cout << "Yield solver (" << prices.size() << " GovBond prices)" << std::endl;
+    const BondAnalytics::Isa isas[] = {
+        BondAnalytics::Isa::Scalar, BondAnalytics::Isa::Sse2, BondAnalytics::Isa::Avx2 };
+    for (auto isa : isas) {
+        BondAnalytics analytics(BondAnalytics::Terms { 4.0, 10, 2 }, isa);
+        if (analytics.isa() != isa) continue;
+        run(std::string("  ") + BondAnalytics::isaName(isa), prices.size(),
+            [&] { analytics.solve(prices, notionals, results); });
+    }
+
+    GovBondPricingEngine gov;
+    CorpBondPricingEngine corp;
+    gov.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    corp.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    ResultBatch govResults;
+    ResultBatch corpResults;
+
+    std::cout << std::endl << "Engines, zero latency (one batch per engine)" << std::endl;
+    std::streambuf* console = std::cout.rdbuf(nullptr);    // engines log every batch
+    auto price = [&] {
+        priceBatch(gov, govTrades, govResults);
+        priceBatch(corp, corpTrades, corpResults);
+    };
+    price();
+    std::cout.rdbuf(console);
+    run("  GovBond + CorpBond", trades, [&] {
+        std::cout.rdbuf(nullptr);
+        price();
+        std::cout.rdbuf(console);
+    });
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * TokenizerBenchmark
+ *
+ * Compares the shared DelimiterScanner against the tokenizers the loaders
+ * used before it: std::getline over a std::stringstream (BondTradeLoader)
+ * and split_by_delim_str (FxTradeLoader). The legacy versions are copied
+ * here verbatim so the comparison stays meaningful after the loaders moved on.
+ *
+ * Build with optimisations for representative numbers:
+ *   cmake -DCMAKE_BUILD_TYPE=Release .. && make TokenizerBenchmark
+ */
+
+#include "../Loaders/DelimiterScanner.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    constexpr int Rows = 500000;
+    constexpr int Repeats = 5;
+
+    std::string makeBondFeed() {
+        std::string feed = "Type,TradeDate,Instrument,Counterparty,Notional,Rate,TradeId\n";
+        for (int i = 0; i < Rows; ++i) {
+            feed += (i % 3 == 0 ? "CorpBond" : "GovBond");
+            feed += ",2012-04-17,DE0001117794,CSI¬AG,674500000,105.985,GOV";
+            feed += std::to_string(i);
+            feed += '\n';
+        }
+        return feed;
+    }
+
+    std::string makeFxFeed() {
+        std::string feed = "FxTrades¬2012-10-15\r\nType¬TradeDate¬Ccy1¬Ccy2¬Amount¬Rate¬ValueDate¬Counterparty¬TradeId\r\n";
+        for (int i = 0; i < Rows; ++i) {
+            feed += (i % 2 == 0 ? "FxSpot" : "FxFwd");
+            feed += "¬2012-10-08¬EUR¬USD¬145000000¬0.97562¬2012-10-11¬CSI,AG¬SPOT";
+            feed += std::to_string(i);
+            feed += "\r\n";
+        }
+        return feed;
+    }
+
+    // ---- Legacy tokenizers (as previously used by the loaders) ----
+
+    void trim_in_place(std::string& s) {
+        const char* ws = " \t\r\n";
+        auto b = s.find_first_not_of(ws);
+        if (b == std::string::npos) { s.clear(); return; }
+        auto e = s.find_last_not_of(ws);
+        s = s.substr(b, e - b + 1);
+    }
+
+    std::vector<std::string> split_by_delim_str(const std::string& line, const std::string& delim) {
+        std::vector<std::string> out;
+        size_t start = 0;
+
+        while (true) {
+            size_t pos = line.find(delim, start);
+            if (pos == std::string::npos) {
+                std::string token = line.substr(start);
+                trim_in_place(token);
+                out.push_back(token);
+                break;
+            }
+
+            std::string token = line.substr(start, pos - start);
+            trim_in_place(token);
+            out.push_back(token);
+            start = pos + delim.size();
+        }
+
+        return out;
+    }
+
+    std::size_t legacyBond(const std::string& feed) {
+        std::size_t fields = 0;
+        std::istringstream stream(feed);
+        std::string line;
+        while (std::getline(stream, line)) {
+            std::vector<std::string> items;
+            std::stringstream ss(line);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                items.push_back(item);
+            }
+            fields += items.size();
+        }
+        return fields;
+    }
+
+    std::size_t legacyFx(const std::string& feed) {
+        std::size_t fields = 0;
+        const std::string delim = "\xC2\xAC";
+        std::istringstream stream(feed);
+        std::string line;
+        while (std::getline(stream, line)) {
+            fields += split_by_delim_str(line, delim).size();
+        }
+        return fields;
+    }
+
+    // ---- DelimiterScanner ----
+
+    std::size_t scan(const std::string& feed, const DelimiterScanner& scanner) {
+        std::size_t fields = 0;
+        std::array<std::string_view, 16> items;
+        std::string_view text(feed);
+        std::size_t start = 0;
+        while (start < text.size()) {
+            std::size_t end = scanner.findNewline(text, start);
+            if (end == DelimiterScanner::npos) end = text.size();
+            fields += scanner.split(text.substr(start, end - start), items);
+            start = end + 1;
+        }
+        return fields;
+    }
+
+    template <typename F>
+    void run(const std::string& name, std::size_t bytes, F&& body) {
+        double best = 1e300;
+        std::size_t fields = 0;
+        for (int r = 0; r < Repeats; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            fields = body();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() < best) best = elapsed.count();
+        }
+        std::cout << std::left << std::setw(36) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2) << best * 1000.0 << " ms"
+                  << std::setw(10) << std::setprecision(0) << (bytes / best) / (1024.0 * 1024.0) << " MB/s"
+                  << std::setw(12) << fields << " fields" << std::endl;
+    }
+}
+
+int main() {
+    const std::string bondFeed = makeBondFeed();
+    const std::string fxFeed = makeFxFeed();
+
+    std::cout << "Detected instruction set: "
+              << DelimiterScanner::isaName(DelimiterScanner::detectIsa()) << std::endl;
+    std::cout << Rows << " rows, best of " << Repeats << " runs" << std::endl << std::endl;
+
+    const DelimiterScanner::Isa isas[] = {
+        DelimiterScanner::Isa::Scalar, DelimiterScanner::Isa::Sse2, DelimiterScanner::Isa::Avx2 };
+
+    std::cout << "Bond feed (',')" << std::endl;
+    run("  getline + stringstream", bondFeed.size(), [&] { return legacyBond(bondFeed); });
+    for (auto isa : isas) {
+        DelimiterScanner scanner(",", isa);
+        if (scanner.isa() != isa) continue;
+        run(std::string("  DelimiterScanner ") + DelimiterScanner::isaName(isa), bondFeed.size(),
+            [&] { return scan(bondFeed, scanner); });
+    }
+
+    std::cout << std::endl << "FX feed (0xC2 0xAC)" << std::endl;
+    run("  getline + split_by_delim_str", fxFeed.size(), [&] { return legacyFx(fxFeed); });
+    for (auto isa : isas) {
+        DelimiterScanner scanner("\xC2\xAC", isa);
+        if (scanner.isa() != isa) continue;
+        run(std::string("  DelimiterScanner ") + DelimiterScanner::isaName(isa), fxFeed.size(),
+            [&] { return scan(fxFeed, scanner); });
+    }
+
+    return 0;
+}
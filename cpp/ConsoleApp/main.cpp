@@ -40,13 +40,34 @@ int main(int argc, char* argv[]) {
     pricer.price(allTrades, &results);*/
     
     ScalarResults results;
-
-	// Use streaming loader: trades are loaded and priced immediately
-	StreamingTradeLoader streamingLoader;
-	streamingLoader.loadAndPrice(&results);
-		
     ScreenResultPrinter screenPrinter;
-    screenPrinter.printResults(results);
+
+    if (argc > 1 && std::string(argv[1]) == "--parallel") {
+        // Load the whole book, then price what the delta tracker reports as
+        // new or amended on the scheduled thread pool.
+        SerialTradeLoader tradeLoader;
+        auto allTrades = tradeLoader.loadTrades();
+
+        ParallelPricer pricer;
+        TradeDeltaTracker tracker;
+        TradeDeltaTracker::Summary delta = pricer.priceDelta(allTrades, &results, tracker);
+
+        screenPrinter.printResults(results);
+        screenPrinter.printDeltaSummary(delta);
+        screenPrinter.printSchedule(pricer.getLastSchedule());
+
+        for (auto& trades : allTrades) {
+            for (ITrade* trade : trades) {
+                delete trade;
+            }
+        }
+    } else {
+        // Use streaming loader: trades are loaded and priced immediately
+        StreamingTradeLoader streamingLoader;
+        streamingLoader.loadAndPrice(&results);
+
+        screenPrinter.printResults(results);
+    }
     
     std::cout << "Press any key to exit.." << std::endl;
     _getch();
@@ -1,87 +1,153 @@
 #include "BondTradeLoader.h"
+#include "DelimiterScanner.h"
+#include "MappedFile.h"
+#include "TradeFieldParser.h"
+#include <array>
 #include <fstream>
-#include <sstream>
 #include <stdexcept>
-#include <ctime>
-#include <iomanip>
-#include <chrono>
+
+static constexpr std::size_t FieldCount = 7;
 
 // Clean spaces
-static inline void trim_in_place(std::string& s) {
+static inline std::string_view trim(std::string_view s) {
     const char* ws = " \t\r\n";
-    s.erase(0, s.find_first_not_of(ws));
-    s.erase(s.find_last_not_of(ws) + 1);
+    auto b = s.find_first_not_of(ws);
+    if (b == std::string_view::npos) {
+        return std::string_view();
+    }
+    auto e = s.find_last_not_of(ws);
+    return s.substr(b, e - b + 1);
 }
 
-BondTrade* BondTradeLoader::createTradeFromLine(std::string line) {
-    std::vector<std::string> items;
-    std::stringstream ss(line);
-    std::string item;
-    
-    while (std::getline(ss, item, separator)) {
-        items.push_back(item);
+/*
+ * Splits a line into its first FieldCount fields without allocating.
+ * Mirrors std::getline(stream, item, separator): an empty line yields no
+ * fields and a trailing separator does not produce an empty final field.
+ * Returns the number of fields found (capped at FieldCount).
+ */
+static std::size_t splitFields(std::string_view line, const DelimiterScanner& scanner,
+                               std::array<std::string_view, FieldCount>& items) {
+    std::size_t count = 0;
+    std::size_t start = 0;
+
+    while (start < line.size() && count < FieldCount) {
+        std::size_t pos = scanner.findDelimiter(line, start);
+        if (pos == std::string_view::npos) {
+            items[count++] = line.substr(start);
+            break;
+        }
+        items[count++] = line.substr(start, pos - start);
+        start = pos + 1;
     }
-    
-    if (items.size() < 7) {
+
+    return count;
+}
+
+const DelimiterScanner& BondTradeLoader::scanner() {
+    static const DelimiterScanner instance(std::string_view(&separator, 1));
+    return instance;
+}
+
+BondTrade* BondTradeLoader::createTradeFromLine(std::string_view line) {
+    std::array<std::string_view, FieldCount> items;
+
+    if (splitFields(line, scanner(), items) < FieldCount) {
         throw std::runtime_error("Invalid line format");
     }
-    
-    //BondTrade* trade = new BondTrade(items[6]);
-    //* BondTrade* trade = new BondTrade(items[6], items[0]);
-    std::string tradeId = items[6];
-	std::string tradeType = items[0];
-	trim_in_place(tradeId);
-	trim_in_place(tradeType);
-
-	BondTrade* trade = new BondTrade(tradeId, tradeType);
-    
-    
-    std::tm tm = {};
-    std::istringstream dateStream(items[1]);
-    dateStream >> std::get_time(&tm, "%Y-%m-%d");
-    auto timePoint = std::chrono::system_clock::from_time_t(std::mktime(&tm));
-    trade->setTradeDate(timePoint);
-    
-     
-    trade->setInstrument(items[2]);
-    trade->setCounterparty(items[3]);
-    trade->setNotional(std::stod(items[4]));
-    trade->setRate(std::stod(items[5]));
-    
+
+    // Strings are only materialized here, once we know the line is a trade.
+    BondTrade* trade = new BondTrade(std::string(trim(items[6])), std::string(trim(items[0])));
+
+    try {
+        trade->setTradeDate(TradeFieldParser::parseDate(items[1]));
+        trade->setInstrument(std::string(items[2]));
+        trade->setCounterparty(std::string(items[3]));
+        trade->setNotional(TradeFieldParser::parseDouble(items[4]));
+        trade->setRate(TradeFieldParser::parseDouble(items[5]));
+    } catch (...) {
+        delete trade;
+        throw;
+    }
+
     return trade;
 }
 
 
-void BondTradeLoader::loadTradesFromFile(std::string filename, BondTradeList& tradeList) {
-    if (filename.empty()) {
-        throw std::invalid_argument("Filename cannot be null");
-    }
-    
-    std::ifstream stream(filename);
-    if (!stream.is_open()) {
-        throw std::runtime_error("Cannot open file: " + filename);
-    }
-    
-    int lineCount = 0;
-    std::string line;
-    while (std::getline(stream, line)) {
-        if (lineCount == 0) {
+/*
+ * Cursor
+ *
+ * Reads the file either line by line through std::getline or, in memory
+ * mapped mode, as string_view slices of the mapping so that the only
+ * allocations are the ones made for each BondTrade. Either way the header
+ * line is skipped and a final newline does not produce an extra empty line.
+ */
+class BondTradeLoader::Cursor : public ITradeCursor {
+public:
+    Cursor(const std::string& filename, bool memoryMapped) {
+        if (filename.empty()) {
+            throw std::invalid_argument("Filename cannot be null");
+        }
+
+        if (memoryMapped) {
+            file_ = std::make_unique<MappedFile>(filename);
         } else {
-            tradeList.add(createTradeFromLine(line));
+            stream_.open(filename);
+            if (!stream_.is_open()) {
+                throw std::runtime_error("Cannot open file: " + filename);
+            }
         }
-        lineCount++;
+
+        // Skip the header line
+        std::string_view header;
+        nextLine(header);
     }
-}
 
-std::vector<ITrade*> BondTradeLoader::loadTrades() {
-    BondTradeList tradeList;
-    loadTradesFromFile(dataFile_, tradeList);
-    
-    std::vector<ITrade*> result;
-    for (size_t i = 0; i < tradeList.size(); ++i) {
-        result.push_back(tradeList[i]);
+    std::size_t nextBatch(std::vector<ITrade*>& batch, std::size_t maxTrades) override {
+        const std::size_t start = batch.size();
+        try {
+            std::string_view line;
+            while (batch.size() - start < maxTrades && nextLine(line)) {
+                batch.push_back(createTradeFromLine(line));
+            }
+        } catch (...) {
+            for (std::size_t i = start; i < batch.size(); ++i) delete batch[i];
+            batch.resize(start);
+            throw;
+        }
+        return batch.size() - start;
+    }
+
+private:
+    bool nextLine(std::string_view& line) {
+        if (!file_) {
+            if (!std::getline(stream_, buffer_)) {
+                return false;
+            }
+            line = buffer_;
+            return true;
+        }
+
+        std::string_view content = file_->view();
+        if (offset_ >= content.size()) {
+            return false;
+        }
+        std::size_t end = scanner().findNewline(content, offset_);
+        if (end == std::string_view::npos) {
+            end = content.size();
+        }
+        line = content.substr(offset_, end - offset_);
+        offset_ = end + 1;
+        return true;
     }
-    return result;
+
+    std::ifstream stream_;
+    std::string buffer_;
+    std::unique_ptr<MappedFile> file_;
+    std::size_t offset_ = 0;
+};
+
+std::unique_ptr<ITradeCursor> BondTradeLoader::openCursor() {
+    return std::make_unique<Cursor>(dataFile_, memoryMapped_);
 }
 
 std::string BondTradeLoader::getDataFile() const {
@@ -90,4 +156,66 @@ std::string BondTradeLoader::getDataFile() const {
 
 void BondTradeLoader::setDataFile(const std::string& file) {
     dataFile_ = file;
+    follower_.reset();
+}
+
+/*
+ * Follow mode
+ *
+ * FileFollower hands back only complete records appended since the last
+ * poll. After a reload the chunk starts at the top of the file, so the
+ * header line is skipped again. Blank lines are tolerated here because an
+ * appender that writes "\n<row>" leaves one between polls. The chunk is only
+ * committed once every row in it has parsed: a bad row fails the poll and the
+ * next poll retries the same records rather than skipping past them.
+ */
+ITradeFollower::FollowStatus BondTradeLoader::pollTrades(std::vector<ITrade*>& trades) {
+    if (!follower_) {
+        follower_ = std::make_unique<FileFollower>(dataFile_);
+    }
+
+    std::string records;
+    FileFollower::Status status = follower_->poll(records);
+    bool skipHeader = status == FileFollower::Status::Reloaded;
+
+    const std::size_t start = trades.size();
+    try {
+        std::string_view content(records);
+        std::size_t offset = 0;
+        while (offset < content.size()) {
+            std::size_t end = scanner().findNewline(content, offset);
+            if (end == std::string_view::npos) {
+                end = content.size();
+            }
+            std::string_view line = content.substr(offset, end - offset);
+            offset = end + 1;
+
+            if (skipHeader) {
+                skipHeader = false;
+                continue;
+            }
+            if (trim(line).empty()) continue;
+
+            trades.push_back(createTradeFromLine(line));
+        }
+    } catch (...) {
+        for (std::size_t i = start; i < trades.size(); ++i) delete trades[i];
+        trades.resize(start);
+        throw;
+    }
+    follower_->commit();
+
+    switch (status) {
+    case FileFollower::Status::Reloaded: return FollowStatus::Reloaded;
+    case FileFollower::Status::Appended: return FollowStatus::Appended;
+    default: return FollowStatus::Unchanged;
+    }
+}
+
+bool BondTradeLoader::isMemoryMapped() const {
+    return memoryMapped_;
+}
+
+void BondTradeLoader::setMemoryMapped(bool memoryMapped) {
+    memoryMapped_ = memoryMapped;
 }
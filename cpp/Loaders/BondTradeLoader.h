@@ -2,24 +2,40 @@
 #define BONDTRADELOADER_H
 
 #include "ITradeLoader.h"
+#include "ITradeFollower.h"
+#include "FileFollower.h"
 #include "../Models/BondTrade.h"
-#include "../Models/BondTradeList.h"
+#include "DelimiterScanner.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 
-class BondTradeLoader : public ITradeLoader {
+class BondTradeLoader : public ITradeLoader, public ITradeFollower {
 private:
     static constexpr char separator = ',';
     std::string dataFile_;
-    
-    BondTrade* createTradeFromLine(std::string line);
-    void loadTradesFromFile(std::string filename, BondTradeList& tradeList);
-    
+    bool memoryMapped_ = false;
+
+    std::unique_ptr<FileFollower> follower_;
+
+    class Cursor;
+
+    static const DelimiterScanner& scanner();
+    static BondTrade* createTradeFromLine(std::string_view line);
+
 public:
-    std::vector<ITrade*> loadTrades() override;
+    std::unique_ptr<ITradeCursor> openCursor() override;
     std::string getDataFile() const override;
     void setDataFile(const std::string& file) override;
+
+    // Follow mode: yields only trades appended since the previous poll.
+    FollowStatus pollTrades(std::vector<ITrade*>& trades) override;
+
+    // When enabled the data file is mmap'ed and tokenized in place instead of
+    // being read line by line through std::getline.
+    bool isMemoryMapped() const;
+    void setMemoryMapped(bool memoryMapped);
 };
 
 #endif // BONDTRADELOADER_H
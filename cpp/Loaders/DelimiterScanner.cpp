@@ -0,0 +1,155 @@
+#include "DelimiterScanner.h"
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+    inline unsigned int lowestBit(unsigned int mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned int>(index);
+#else
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+    }
+
+    /*
+     * Scalar kernels
+     * Used on non-x86 targets and for the tails shorter than one vector.
+     */
+    const char* findByteScalar(const char* p, const char* end, char c) {
+        if (p >= end) return end;
+        const void* hit = std::memchr(p, c, static_cast<std::size_t>(end - p));
+        return hit != nullptr ? static_cast<const char*>(hit) : end;
+    }
+
+    const char* findPairScalar(const char* p, const char* end, char c0, char c1) {
+        while (p + 1 < end) {
+            p = findByteScalar(p, end - 1, c0);
+            if (p >= end - 1) break;
+            if (p[1] == c1) return p;
+            ++p;
+        }
+        return end;
+    }
+
+#ifdef CPUISA_SSE2
+    const char* findByteSse2(const char* p, const char* end, char c) {
+        const __m128i needle = _mm_set1_epi8(c);
+        while (end - p >= 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+            if (mask != 0) return p + lowestBit(mask);
+            p += 16;
+        }
+        return findByteScalar(p, end, c);
+    }
+
+    // Matches c0 at offset i and c1 at offset i + 1 by comparing two overlapping loads.
+    const char* findPairSse2(const char* p, const char* end, char c0, char c1) {
+        const __m128i first = _mm_set1_epi8(c0);
+        const __m128i second = _mm_set1_epi8(c1);
+        while (end - p >= 17) {
+            __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+            __m128i hits = _mm_and_si128(_mm_cmpeq_epi8(block0, first), _mm_cmpeq_epi8(block1, second));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+            if (mask != 0) return p + lowestBit(mask);
+            p += 16;
+        }
+        return findPairScalar(p, end, c0, c1);
+    }
+#endif
+
+#ifdef CPUISA_AVX2
+    CPUISA_TARGET_AVX2
+    const char* findByteAvx2(const char* p, const char* end, char c) {
+        const __m256i needle = _mm256_set1_epi8(c);
+        while (end - p >= 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+            if (mask != 0) return p + lowestBit(mask);
+            p += 32;
+        }
+        return findByteSse2(p, end, c);
+    }
+
+    CPUISA_TARGET_AVX2
+    const char* findPairAvx2(const char* p, const char* end, char c0, char c1) {
+        const __m256i first = _mm256_set1_epi8(c0);
+        const __m256i second = _mm256_set1_epi8(c1);
+        while (end - p >= 33) {
+            __m256i block0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+            __m256i hits = _mm256_and_si256(_mm256_cmpeq_epi8(block0, first), _mm256_cmpeq_epi8(block1, second));
+            unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(hits));
+            if (mask != 0) return p + lowestBit(mask);
+            p += 32;
+        }
+        return findPairSse2(p, end, c0, c1);
+    }
+#endif
+
+    const char* findByte(DelimiterScanner::Isa isa, const char* p, const char* end, char c) {
+        switch (isa) {
+#ifdef CPUISA_AVX2
+        case DelimiterScanner::Isa::Avx2: return findByteAvx2(p, end, c);
+#endif
+#ifdef CPUISA_SSE2
+        case DelimiterScanner::Isa::Sse2: return findByteSse2(p, end, c);
+#endif
+        default: return findByteScalar(p, end, c);
+        }
+    }
+
+    const char* findPair(DelimiterScanner::Isa isa, const char* p, const char* end, char c0, char c1) {
+        switch (isa) {
+#ifdef CPUISA_AVX2
+        case DelimiterScanner::Isa::Avx2: return findPairAvx2(p, end, c0, c1);
+#endif
+#ifdef CPUISA_SSE2
+        case DelimiterScanner::Isa::Sse2: return findPairSse2(p, end, c0, c1);
+#endif
+        default: return findPairScalar(p, end, c0, c1);
+        }
+    }
+}
+
+DelimiterScanner::DelimiterScanner(std::string_view delimiter)
+    : DelimiterScanner(delimiter, detectIsa()) {
+}
+
+DelimiterScanner::DelimiterScanner(std::string_view delimiter, Isa isa)
+    : first_(0), second_(0), delimiterSize_(delimiter.size()), isa_(isa) {
+    if (delimiter.empty() || delimiter.size() > 2) {
+        throw std::invalid_argument("Delimiter must be one or two bytes");
+    }
+    first_ = delimiter[0];
+    second_ = delimiter.size() == 2 ? delimiter[1] : 0;
+
+    // Never run an instruction set the CPU does not have.
+    isa_ = CpuIsa::supported(isa_);
+}
+
+std::size_t DelimiterScanner::findDelimiter(std::string_view text, std::size_t pos) const {
+    if (pos >= text.size()) return npos;
+
+    const char* end = text.data() + text.size();
+    const char* hit = delimiterSize_ == 1
+        ? findByte(isa_, text.data() + pos, end, first_)
+        : findPair(isa_, text.data() + pos, end, first_, second_);
+    return hit == end ? npos : static_cast<std::size_t>(hit - text.data());
+}
+
+std::size_t DelimiterScanner::findNewline(std::string_view text, std::size_t pos) const {
+    if (pos >= text.size()) return npos;
+
+    const char* end = text.data() + text.size();
+    const char* hit = findByte(isa_, text.data() + pos, end, '\n');
+    return hit == end ? npos : static_cast<std::size_t>(hit - text.data());
+}
@@ -0,0 +1,79 @@
+#ifndef DELIMITERSCANNER_H
+#define DELIMITERSCANNER_H
+
+#include "../Models/CpuIsa.h"
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/*
+ * DelimiterScanner
+ *
+ * Finds field delimiters and record (newline) boundaries in a text buffer
+ * 16 (SSE2) or 32 (AVX2) bytes at a time. The instruction set is picked once
+ * at runtime from what the CPU supports; other targets fall back to scalar
+ * memchr-based scanning, so results are identical on every host.
+ *
+ * Delimiters may be one byte (',') or two bytes (the UTF-8 '¬', 0xC2 0xAC).
+ * Both trade loaders tokenize through this class.
+ */
+class DelimiterScanner {
+public:
+    using Isa = CpuIsa::Isa;
+
+    static constexpr std::size_t npos = std::string_view::npos;
+
+    // Uses the best instruction set available on this CPU.
+    explicit DelimiterScanner(std::string_view delimiter);
+    // Forces a specific instruction set, downgraded if the CPU lacks it.
+    DelimiterScanner(std::string_view delimiter, Isa isa);
+
+    // Offset of the next delimiter at or after pos, or npos.
+    std::size_t findDelimiter(std::string_view text, std::size_t pos) const;
+
+    // Offset of the next '\n' at or after pos, or npos.
+    std::size_t findNewline(std::string_view text, std::size_t pos) const;
+
+    std::size_t delimiterSize() const { return delimiterSize_; }
+    Isa isa() const { return isa_; }
+
+    /*
+     * Splits a record into fields. Returns the total number of fields on the
+     * line; only the first N are stored in items.
+     */
+    template <std::size_t N>
+    std::size_t split(std::string_view line, std::array<std::string_view, N>& items) const {
+        std::size_t count = 0;
+        std::size_t start = 0;
+
+        while (true) {
+            std::size_t pos = findDelimiter(line, start);
+            std::string_view token = pos == npos
+                ? line.substr(start)
+                : line.substr(start, pos - start);
+
+            if (count < N) {
+                items[count] = token;
+            }
+            ++count;
+
+            if (pos == npos) {
+                break;
+            }
+            start = pos + delimiterSize_;
+        }
+
+        return count;
+    }
+
+    static Isa detectIsa() { return CpuIsa::detect(); }
+    static const char* isaName(Isa isa) { return CpuIsa::name(isa); }
+
+private:
+    char first_;
+    char second_;
+    std::size_t delimiterSize_;
+    Isa isa_;
+};
+
+#endif // DELIMITERSCANNER_H
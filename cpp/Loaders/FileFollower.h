@@ -0,0 +1,84 @@
+#ifndef FILEFOLLOWER_H
+#define FILEFOLLOWER_H
+
+#include <cstdint>
+#include <string>
+
+/*
+ * FileFollower
+ *
+ * Tracks how far into a growing text file previous polls have read and
+ * returns only the complete records appended since.
+ *
+ * poll only peeks: the records it returns are consumed once the caller
+ * commits them. A caller that fails to parse a chunk simply does not commit,
+ * and the next poll hands back the same records (plus anything appended
+ * since) instead of losing them.
+ *
+ * A record is complete once it is terminated by '\n'; a poll, reload or not,
+ * stops at the last newline since a writer may be part way through the line
+ * after it. An unterminated final line is handed out only once the file size
+ * has stayed the same across two polls, so a file that simply does not end
+ * in a newline is still read in full. A reload that finds no complete line
+ * yet (e.g. a header still being written) leaves the follower unstarted, and
+ * the next poll reloads again.
+ *
+ * The file is considered rotated or truncated, and is re-read from the start,
+ * when it shrinks, when its identity (device/inode) changes, or when the bytes
+ * at the beginning of the file no longer match what was read before.
+ */
+class FileFollower {
+public:
+    enum class Status {
+        Unchanged,   // nothing new
+        Appended,    // records holds newly appended complete records
+        Reloaded     // records holds the whole file; previous state is void
+    };
+
+    explicit FileFollower(std::string filename);
+
+    Status poll(std::string& records);
+
+    // Marks the records returned by the last poll as consumed.
+    void commit();
+
+    // Forget everything read so far; the next poll is a full reload.
+    void reset();
+
+    const std::string& getFilename() const { return filename_; }
+    std::uint64_t getOffset() const { return committed_.offset; }
+
+private:
+    struct Identity {
+        std::uint64_t device = 0;
+        std::uint64_t inode = 0;
+        bool operator!=(const Identity& other) const {
+            return device != other.device || inode != other.inode;
+        }
+    };
+
+    static constexpr std::size_t FingerprintSize = 256;
+
+    // What the follower will have read once the last poll is committed.
+    struct Position {
+        std::uint64_t offset = 0;
+        Identity identity;
+        std::string fingerprint;
+        bool started = false;
+    };
+
+    bool statFile(Identity& identity, std::uint64_t& size) const;
+
+    std::string filename_;
+    Position committed_;
+    Position pending_;
+    bool hasPending_ = false;
+
+    // File as seen by the previous poll, to tell a stalled tail from one
+    // still being written.
+    Identity lastIdentity_;
+    std::uint64_t lastSize_ = 0;
+    bool polled_ = false;
+};
+
+#endif // FILEFOLLOWER_H
@@ -16,136 +16,327 @@ void FxTradeLoader::setDataFile(const std::string& file) {
 }*/
 
 #include "FxTradeLoader.h"
+#include "DelimiterScanner.h"
+#include "MappedFile.h"
+#include "TradeFieldParser.h"
 #include "../Models/FxTrade.h"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <exception>
 #include <fstream>
-#include <sstream>
+#include <memory>
 #include <stdexcept>
-#include <iomanip>
-#include <chrono>
-#include <ctime>
 #include <string>
+#include <thread>
 #include <vector>
 
+/*
+ * FxTrades.dat delimiter note:
+ * The FX feed uses '¬' (NOT SIGN) as a delimiter, not commas.
+ * In UTF-8 that is the two-byte sequence 0xC2 0xAC, so fields are split on
+ * the byte string rather than on a single char.
+ */
+static constexpr std::string_view Delimiter = "\xC2\xAC";
+
+// Built on first use, so the CPU detection does not run during static init.
+static const DelimiterScanner& scanner() {
+    static const DelimiterScanner instance(Delimiter);
+    return instance;
+}
+
+// Data lines must have 9 fields per header
+// Type, TradeDate, Ccy1, Ccy2, Amount, Rate, ValueDate, Counterparty, TradeId
+static constexpr std::size_t FieldCount = 9;
+
+// Below this many bytes per thread, spinning up workers costs more than it saves.
+static constexpr std::size_t MinChunkBytes = 64 * 1024;
+
 /*
  * Reused from BondTradeLoader:
  * Trim whitespace + Windows CR/LF. Prevents hidden '\r' from breaking string equality tests.
  */
-static inline void trim_in_place(std::string& s) {
+static inline std::string_view trim(std::string_view s) {
     const char* ws = " \t\r\n";
     auto b = s.find_first_not_of(ws);
-    if (b == std::string::npos) { s.clear(); return; }
+    if (b == std::string_view::npos) {
+        return std::string_view();
+    }
     auto e = s.find_last_not_of(ws);
-    s = s.substr(b, e - b + 1);
+    return s.substr(b, e - b + 1);
 }
 
 /*
- * FxTrades.dat delimiter note:
- * The FX feed uses '¬' (NOT SIGN) as a delimiter, not commas.
- * Use string-splitting (not char-based getline) because '¬' is often multi-byte in UTF-8.
+ * Splits a line on the delimiter into trimmed string_view fields.
+ * Returns the total number of fields on the line; only the first
+ * FieldCount are stored.
  */
-static std::vector<std::string> split_by_delim_str(const std::string& line, const std::string& delim) {
-    std::vector<std::string> out;
-    size_t start = 0;
-
-    while (true) {
-        size_t pos = line.find(delim, start);
-        if (pos == std::string::npos) {
-            std::string token = line.substr(start);
-            trim_in_place(token);
-            out.push_back(token);
-            break;
-        }
+static std::size_t splitFields(std::string_view line, std::array<std::string_view, FieldCount>& items) {
+    std::size_t count = scanner().split(line, items);
+    for (std::size_t i = 0; i < count && i < FieldCount; ++i) {
+        items[i] = trim(items[i]);
+    }
+    return count;
+}
+
+// Footer: "END¬<count>"
+static bool isFooter(const std::array<std::string_view, FieldCount>& items) {
+    return items[0] == "END";
+}
 
-        std::string token = line.substr(start, pos - start);
-        trim_in_place(token);
-        out.push_back(token);
-        start = pos + delim.size();
+/*
+ * Footer check shared by the serial and parallel paths. The count covers
+ * every record after the metadata line: the header plus each data row.
+ */
+static void checkFooter(std::string_view footerCount, std::size_t tradeRows) {
+    std::size_t expected = 0;
+    auto parsed = std::from_chars(footerCount.data(), footerCount.data() + footerCount.size(), expected);
+    if (footerCount.empty() || parsed.ec != std::errc() || parsed.ptr != footerCount.data() + footerCount.size()) {
+        throw std::runtime_error("Invalid FX footer count");
     }
+    if (expected != tradeRows + 1) {
+        throw std::runtime_error(
+            "FX footer count " + std::to_string(expected) + " does not match " +
+            std::to_string(tradeRows) + " trade rows plus header");
+    }
+}
 
-    return out;
+static FxTrade* createTrade(const std::array<std::string_view, FieldCount>& items, std::size_t fieldCount) {
+    if (fieldCount < FieldCount) {
+        throw std::runtime_error("Invalid FX trade line");
+    }
+
+    // Reused construction style from BondTradeLoader (tradeId + tradeType)
+    FxTrade* trade = new FxTrade(std::string(items[8]), std::string(items[0]));
+
+    try {
+        // FxTrades.dat has both TradeDate and ValueDate
+        trade->setTradeDate(TradeFieldParser::parseDate(items[1]));
+        trade->setValueDate(TradeFieldParser::parseDate(items[6]));
+
+        // Exercise requirement: Instrument = Ccy1 + Ccy2
+        std::string instrument;
+        instrument.reserve(items[2].size() + items[3].size());
+        instrument.append(items[2]).append(items[3]);
+        trade->setInstrument(instrument);
+
+        trade->setCounterparty(std::string(items[7]));
+
+        // Amount -> notional, Rate -> rate
+        trade->setNotional(TradeFieldParser::parseDouble(items[4]));
+        trade->setRate(TradeFieldParser::parseDouble(items[5]));
+    } catch (...) {
+        delete trade;
+        throw;
+    }
+
+    return trade;
 }
 
 std::vector<ITrade*> FxTradeLoader::loadTrades() {
     // Reused pattern from BondTradeLoader: validate file path, open stream
     if (dataFile_.empty()) throw std::runtime_error("FX data file not set");
 
-    std::ifstream stream(dataFile_);
-    if (!stream.is_open()) throw std::runtime_error("Cannot open file: " + dataFile_);
-
-    const std::string delim = u8"¬";
-
-    std::vector<ITrade*> result;
-    std::string line;
+    return parallel_ ? loadTradesParallel() : ITradeLoader::loadTrades();
+}
 
-    /*
-     * FxTrades.dat format (as you pasted):
-     *
-     * Line 1:  FxTrades¬YYYY-MM-DD              (file metadata)    -> skip
-     * Line 2:  Type¬TradeDate¬Ccy1¬...¬TradeId  (header)           -> skip (we use fixed indices)
-     * Lines :  FxSpot/FxFwd ...                 (data rows)        -> parse
-     * Last :   END¬<count>                      (footer)           -> stop
-     */
+/*
+ * Cursor
+ *
+ * FxTrades.dat format:
+ *
+ * Line 1:  FxTrades¬YYYY-MM-DD              (file metadata)    -> skip
+ * Line 2:  Type¬TradeDate¬Ccy1¬...¬TradeId  (header)           -> skip (we use fixed indices)
+ * Lines :  FxSpot/FxFwd ...                 (data rows)        -> parse
+ * Last :   END¬<count>                      (footer)           -> check, stop
+ */
+class FxTradeLoader::Cursor : public ITradeCursor {
+public:
+    explicit Cursor(const std::string& filename) : stream_(filename) {
+        if (!stream_.is_open()) throw std::runtime_error("Cannot open file: " + filename);
+
+        // Skip metadata and header lines
+        std::string line;
+        done_ = !std::getline(stream_, line) || !std::getline(stream_, line);
+    }
 
-    // Skip metadata line
-    if (!std::getline(stream, line)) return result;
+    std::size_t nextBatch(std::vector<ITrade*>& batch, std::size_t maxTrades) override {
+        const std::size_t start = batch.size();
+        std::array<std::string_view, FieldCount> items;
+
+        try {
+            while (!done_ && batch.size() - start < maxTrades) {
+                if (!std::getline(stream_, line_)) {
+                    done_ = true;
+                    break;
+                }
+                if (line_.empty()) continue;
+
+                std::size_t fieldCount = splitFields(line_, items);
+
+                // Stop at footer: "END¬5"
+                if (isFooter(items)) {
+                    done_ = true;
+                    checkFooter(fieldCount > 1 ? items[1] : std::string_view(), rows_ + batch.size() - start);
+                    break;
+                }
+
+                batch.push_back(createTrade(items, fieldCount));
+            }
+        } catch (...) {
+            for (std::size_t i = start; i < batch.size(); ++i) delete batch[i];
+            batch.resize(start);
+            throw;
+        }
 
-    // Skip header line
-    if (!std::getline(stream, line)) return result;
+        rows_ += batch.size() - start;
+        return batch.size() - start;
+    }
 
-    while (std::getline(stream, line)) {
-        if (line.empty()) continue;
+private:
+    std::ifstream stream_;
+    std::string line_;
+    std::size_t rows_ = 0;      // trades returned so far, for the footer check
+    bool done_ = false;
+};
 
-        auto items = split_by_delim_str(line, delim);
-        if (items.empty()) continue;
+std::unique_ptr<ITradeCursor> FxTradeLoader::openCursor() {
+    if (dataFile_.empty()) throw std::runtime_error("FX data file not set");
+    return std::make_unique<Cursor>(dataFile_);
+}
 
-        // Stop at footer: "END¬5"
-        if (items[0] == "END") {
-            break;
+/*
+ * Parallel ingest
+ *
+ * Layout handling is identical to the serial path: the metadata and header
+ * lines are skipped, empty lines are ignored and parsing stops at the first
+ * END footer. Only the data section is split across threads.
+ *
+ * Each thread owns a byte range whose start has been moved forward to the
+ * beginning of a line, so every line belongs to exactly one range. A range
+ * that reaches a footer stops there and records it; when merging, ranges
+ * after the first footer are discarded, which reproduces the serial "stop at
+ * END" behaviour.
+ *
+ * The footer count is validated with the same checkFooter as the serial
+ * path, against the data rows summed across ranges.
+ */
+namespace {
+    struct FxChunk {
+        std::vector<ITrade*> trades;
+        bool footerFound = false;
+        std::string_view footerCount;
+        std::exception_ptr error;
+    };
+
+    void parseChunk(std::string_view data, FxChunk& chunk) {
+        std::array<std::string_view, FieldCount> items;
+        try {
+            std::size_t start = 0;
+            while (start < data.size()) {
+                std::size_t end = scanner().findNewline(data, start);
+                if (end == std::string_view::npos) {
+                    end = data.size();
+                }
+                std::string_view line = data.substr(start, end - start);
+                start = end + 1;
+
+                if (line.empty()) continue;
+
+                std::size_t fieldCount = splitFields(line, items);
+                if (isFooter(items)) {
+                    chunk.footerFound = true;
+                    chunk.footerCount = fieldCount > 1 ? items[1] : std::string_view();
+                    break;
+                }
+
+                chunk.trades.push_back(createTrade(items, fieldCount));
+            }
+        } catch (...) {
+            chunk.error = std::current_exception();
         }
+    }
 
-        // Data lines must have 9 fields per header
-        // Type, TradeDate, Ccy1, Ccy2, Amount, Rate, ValueDate, Counterparty, TradeId
-        if (items.size() < 9) {
-            throw std::runtime_error("Invalid FX trade line");
+    // Returns the offset just past the next '\n' at or after pos.
+    std::size_t nextLineStart(std::string_view content, std::size_t pos) {
+        if (pos >= content.size()) {
+            return content.size();
         }
+        std::size_t nl = scanner().findNewline(content, pos);
+        return nl == std::string_view::npos ? content.size() : nl + 1;
+    }
+}
 
-        const std::string& type    = items[0];
-        // FxTrades.dat has both TradeDate and ValueDate
-		const std::string& dateStr = items[1];  // TradeDate
-		const std::string& valueDateStr = items[6];  // ValueDate
-        const std::string& ccy1    = items[2];
-        const std::string& ccy2    = items[3];
-        const std::string& amount  = items[4];
-        const std::string& rate    = items[5];
-        const std::string& cpty    = items[7];
-        const std::string& tradeId = items[8];
-
-        // Reused construction style from BondTradeLoader (tradeId + tradeType)
-        FxTrade* trade = new FxTrade(tradeId, type);
-
-        // Reused date parsing logic from BondTradeLoader
-        std::tm tm = {};
-        std::istringstream ds(dateStr);
-        ds >> std::get_time(&tm, "%Y-%m-%d");
-        trade->setTradeDate(std::chrono::system_clock::from_time_t(std::mktime(&tm)));
-        
-        // Specific for FxTrade✅ Add ValueDate on FxTrade  
-		std::tm tmVal = {};
-		std::istringstream vds(valueDateStr);
-		vds >> std::get_time(&tmVal, "%Y-%m-%d");
-		trade->setValueDate(std::chrono::system_clock::from_time_t(std::mktime(&tmVal)));
+std::vector<ITrade*> FxTradeLoader::loadTradesParallel() {
+    MappedFile file(dataFile_);
+    std::string_view content = file.view();
 
-        // Exercise requirement: Instrument = Ccy1 + Ccy2
-        trade->setInstrument(ccy1 + ccy2);
+    std::vector<ITrade*> result;
 
-        trade->setCounterparty(cpty);
+    // Skip metadata and header lines, matching the serial path when either is missing.
+    std::size_t metadataEnd = scanner().findNewline(content, 0);
+    if (content.empty() || metadataEnd == std::string_view::npos) return result;
+    std::size_t headerEnd = scanner().findNewline(content, metadataEnd + 1);
+    if (headerEnd == std::string_view::npos) return result;
+
+    std::size_t dataStart = headerEnd + 1;
+    std::string_view data = content.substr(dataStart);
+
+    unsigned int threads = threadCount_ != 0 ? threadCount_ : std::thread::hardware_concurrency();
+    std::size_t maxChunks = std::max<std::size_t>(1, data.size() / MinChunkBytes);
+    std::size_t chunkCount = std::clamp<std::size_t>(threads, 1, maxChunks);
+
+    // Newline-aligned chunk boundaries: [bounds[i], bounds[i + 1])
+    std::vector<std::size_t> bounds(chunkCount + 1, data.size());
+    bounds[0] = 0;
+    for (std::size_t i = 1; i < chunkCount; ++i) {
+        std::size_t target = data.size() * i / chunkCount;
+        bounds[i] = std::max(bounds[i - 1], nextLineStart(data, target == 0 ? 0 : target - 1));
+    }
 
-        // Amount -> notional, Rate -> rate
-        trade->setNotional(std::stod(amount));
-        trade->setRate(std::stod(rate));
+    std::vector<FxChunk> chunks(chunkCount);
+    std::vector<std::thread> workers;
+    workers.reserve(chunkCount - 1);
+    for (std::size_t i = 1; i < chunkCount; ++i) {
+        workers.emplace_back(parseChunk, data.substr(bounds[i], bounds[i + 1] - bounds[i]), std::ref(chunks[i]));
+    }
+    // The calling thread takes the first range rather than sitting idle.
+    parseChunk(data.substr(bounds[0], bounds[1] - bounds[0]), chunks[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Merge in file order, stopping at the first footer.
+    std::exception_ptr error;
+    bool footerFound = false;
+    std::string_view footerCount;
+    for (auto& chunk : chunks) {
+        if (footerFound || error) {
+            for (ITrade* trade : chunk.trades) delete trade;
+            continue;
+        }
+        result.insert(result.end(), chunk.trades.begin(), chunk.trades.end());
+        if (chunk.error) {
+            error = chunk.error;
+        }
+        if (chunk.footerFound) {
+            footerFound = true;
+            footerCount = chunk.footerCount;
+        }
+    }
+
+    if (!error && footerFound) {
+        try {
+            checkFooter(footerCount, result.size());
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
 
-        result.push_back(trade);
+    if (error) {
+        for (ITrade* trade : result) delete trade;
+        std::rethrow_exception(error);
     }
 
     return result;
@@ -158,5 +349,77 @@ std::string FxTradeLoader::getDataFile() const {
 
 void FxTradeLoader::setDataFile(const std::string& file) {
     dataFile_ = file;
+    follower_.reset();
+}
+
+/*
+ * Follow mode
+ *
+ * After a reload the metadata and header lines are skipped again. Footer
+ * lines are skipped rather than ending the read: in a file that is being
+ * appended to, new rows can follow an earlier END line. As for bonds, the
+ * chunk is committed only after all of its rows have parsed.
+ */
+ITradeFollower::FollowStatus FxTradeLoader::pollTrades(std::vector<ITrade*>& trades) {
+    if (dataFile_.empty()) throw std::runtime_error("FX data file not set");
+    if (!follower_) {
+        follower_ = std::make_unique<FileFollower>(dataFile_);
+    }
+
+    std::string records;
+    FileFollower::Status status = follower_->poll(records);
+    int linesToSkip = status == FileFollower::Status::Reloaded ? 2 : 0;
+
+    const std::size_t start = trades.size();
+    std::array<std::string_view, FieldCount> items;
+    try {
+        std::string_view content(records);
+        std::size_t offset = 0;
+        while (offset < content.size()) {
+            std::size_t end = scanner().findNewline(content, offset);
+            if (end == std::string_view::npos) {
+                end = content.size();
+            }
+            std::string_view line = content.substr(offset, end - offset);
+            offset = end + 1;
+
+            if (linesToSkip > 0) {
+                --linesToSkip;
+                continue;
+            }
+            if (trim(line).empty()) continue;
+
+            std::size_t fieldCount = splitFields(line, items);
+            if (isFooter(items)) continue;
+
+            trades.push_back(createTrade(items, fieldCount));
+        }
+    } catch (...) {
+        for (std::size_t i = start; i < trades.size(); ++i) delete trades[i];
+        trades.resize(start);
+        throw;
+    }
+    follower_->commit();
+
+    switch (status) {
+    case FileFollower::Status::Reloaded: return FollowStatus::Reloaded;
+    case FileFollower::Status::Appended: return FollowStatus::Appended;
+    default: return FollowStatus::Unchanged;
+    }
+}
+
+bool FxTradeLoader::isParallel() const {
+    return parallel_;
 }
 
+void FxTradeLoader::setParallel(bool parallel) {
+    parallel_ = parallel;
+}
+
+unsigned int FxTradeLoader::getThreadCount() const {
+    return threadCount_;
+}
+
+void FxTradeLoader::setThreadCount(unsigned int threadCount) {
+    threadCount_ = threadCount;
+}
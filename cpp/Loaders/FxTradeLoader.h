@@ -2,19 +2,44 @@
 #define FXTRADELOADER_H
 
 #include "ITradeLoader.h"
+#include "ITradeFollower.h"
+#include "FileFollower.h"
 #include "../Models/FxTrade.h"
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
-class FxTradeLoader : public ITradeLoader {
+class FxTradeLoader : public ITradeLoader, public ITradeFollower {
 private:
     std::string dataFile_;
-    
+    bool parallel_ = false;
+    unsigned int threadCount_ = 0;
+
+    std::unique_ptr<FileFollower> follower_;
+
+    class Cursor;
+
+    std::vector<ITrade*> loadTradesParallel();
+
 public:
-    // NOTE: These methods are only here to allow the solution to compile prior to the test being completed.
+    std::unique_ptr<ITradeCursor> openCursor() override;
+    // Serial mode drains a cursor; parallel mode parses chunks concurrently.
     std::vector<ITrade*> loadTrades() override;
     std::string getDataFile() const override;
     void setDataFile(const std::string& file) override;
+
+    // Follow mode: yields only trades appended since the previous poll.
+    FollowStatus pollTrades(std::vector<ITrade*>& trades) override;
+
+    // When enabled the file is mmap'ed, split into newline-aligned byte ranges
+    // and the ranges are parsed concurrently. Results keep file order.
+    bool isParallel() const;
+    void setParallel(bool parallel);
+
+    // Number of parsing threads for parallel mode; 0 uses hardware_concurrency.
+    unsigned int getThreadCount() const;
+    void setThreadCount(unsigned int threadCount);
 };
 
 #endif // FXTRADELOADER_H
@@ -0,0 +1,22 @@
+#ifndef ITRADECURSOR_H
+#define ITRADECURSOR_H
+
+#include "../Models/ITrade.h"
+#include <cstddef>
+#include <vector>
+
+/*
+ * Pull-based access to the trades of a single load.
+ *
+ * Each call to nextBatch appends at most maxTrades newly allocated trades to
+ * batch and returns how many were appended; 0 means the source is exhausted.
+ * Ownership of the appended trades passes to the caller. If a call throws,
+ * nothing is appended by that call.
+ */
+class ITradeCursor {
+public:
+    virtual ~ITradeCursor() = default;
+    virtual std::size_t nextBatch(std::vector<ITrade*>& batch, std::size_t maxTrades) = 0;
+};
+
+#endif // ITRADECURSOR_H
@@ -0,0 +1,24 @@
+#ifndef ITRADEFOLLOWER_H
+#define ITRADEFOLLOWER_H
+
+#include "../Models/ITrade.h"
+#include <vector>
+
+/*
+ * Incremental ("tail -f") access to a trade file that is appended to.
+ *
+ * pollTrades appends to trades only the trades added to the file since the
+ * previous poll. When the file has been truncated or rotated the follower
+ * starts again from the beginning and reports Reloaded: trades then holds
+ * the whole file and anything derived from earlier polls is out of date.
+ * Ownership of the appended trades passes to the caller.
+ */
+class ITradeFollower {
+public:
+    enum class FollowStatus { Unchanged, Appended, Reloaded };
+
+    virtual ~ITradeFollower() = default;
+    virtual FollowStatus pollTrades(std::vector<ITrade*>& trades) = 0;
+};
+
+#endif // ITRADEFOLLOWER_H
@@ -1,14 +1,36 @@
 #ifndef ITRADELOADER_H
 #define ITRADELOADER_H
 
+#include "ITradeCursor.h"
 #include "../Models/ITrade.h"
+#include <memory>
 #include <vector>
 #include <string>
 
 class ITradeLoader {
 public:
     virtual ~ITradeLoader() = default;
-    virtual std::vector<ITrade*> loadTrades() = 0;
+
+    // Starts a new pass over the data file. Memory held by the cursor is
+    // bounded by the batch size, not by the size of the file.
+    virtual std::unique_ptr<ITradeCursor> openCursor() = 0;
+
+    // Convenience wrapper: drains a cursor into a single vector.
+    virtual std::vector<ITrade*> loadTrades() {
+        static constexpr std::size_t BatchSize = 1024;
+
+        std::vector<ITrade*> trades;
+        auto cursor = openCursor();
+        try {
+            while (cursor->nextBatch(trades, BatchSize) != 0) {
+            }
+        } catch (...) {
+            for (ITrade* trade : trades) delete trade;
+            throw;
+        }
+        return trades;
+    }
+
     virtual std::string getDataFile() const = 0;
     virtual void setDataFile(const std::string& file) = 0;
 };
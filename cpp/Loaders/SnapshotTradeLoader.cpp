@@ -0,0 +1,86 @@
+#include "SnapshotTradeLoader.h"
+#include "TradeSnapshot.h"
+
+SnapshotTradeLoader::SnapshotTradeLoader(std::unique_ptr<ITradeLoader> textLoader)
+    : fallback_(std::move(textLoader)) {
+}
+
+class SnapshotTradeLoader::Cursor : public ITradeCursor {
+public:
+    explicit Cursor(std::unique_ptr<TradeSnapshotReader> reader) : reader_(std::move(reader)) {
+    }
+
+    std::size_t nextBatch(std::vector<ITrade*>& batch, std::size_t maxTrades) override {
+        const std::size_t start = batch.size();
+        const std::size_t startRow = row_;
+        try {
+            while (row_ < reader_->size() && batch.size() - start < maxTrades) {
+                batch.push_back(reader_->createTrade(row_));
+                ++row_;
+            }
+        } catch (...) {
+            for (std::size_t i = start; i < batch.size(); ++i) delete batch[i];
+            batch.resize(start);
+            row_ = startRow;
+            throw;
+        }
+        return batch.size() - start;
+    }
+
+private:
+    std::unique_ptr<TradeSnapshotReader> reader_;
+    std::size_t row_ = 0;
+};
+
+std::unique_ptr<ITradeCursor> SnapshotTradeLoader::openCursor() {
+    auto reader = std::make_unique<TradeSnapshotReader>(getSnapshotFile(), TradeSnapshot::stampOf(getDataFile()));
+
+    lastLoadFromSnapshot_ = reader->isValid();
+    if (!lastLoadFromSnapshot_) {
+        return fallback_.openCursor();
+    }
+    return std::make_unique<Cursor>(std::move(reader));
+}
+
+std::vector<ITrade*> SnapshotTradeLoader::loadTrades() {
+    TradeSnapshotReader reader(getSnapshotFile(), TradeSnapshot::stampOf(getDataFile()));
+
+    if (!reader.isValid()) {
+        lastLoadFromSnapshot_ = false;
+        return fallback_.loadTrades();
+    }
+
+    std::vector<ITrade*> trades;
+    trades.reserve(reader.size());
+    try {
+        for (std::size_t row = 0; row < reader.size(); ++row) {
+            trades.push_back(reader.createTrade(row));
+        }
+    } catch (...) {
+        for (ITrade* trade : trades) delete trade;
+        throw;
+    }
+
+    lastLoadFromSnapshot_ = true;
+    return trades;
+}
+
+std::string SnapshotTradeLoader::getDataFile() const {
+    return fallback_.getDataFile();
+}
+
+void SnapshotTradeLoader::setDataFile(const std::string& file) {
+    fallback_.setDataFile(file);
+}
+
+std::string SnapshotTradeLoader::getSnapshotFile() const {
+    return fallback_.getSnapshotFile();
+}
+
+void SnapshotTradeLoader::setSnapshotFile(const std::string& file) {
+    fallback_.setSnapshotFile(file);
+}
+
+bool SnapshotTradeLoader::lastLoadFromSnapshot() const {
+    return lastLoadFromSnapshot_;
+}
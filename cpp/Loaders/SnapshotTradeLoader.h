@@ -0,0 +1,41 @@
+#ifndef SNAPSHOTTRADELOADER_H
+#define SNAPSHOTTRADELOADER_H
+
+#include "ITradeLoader.h"
+#include "SnapshottingTradeLoader.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * SnapshotTradeLoader
+ *
+ * Loads trades from the binary snapshot of a text trade file when one exists
+ * and is current, skipping text parsing entirely. If the snapshot is missing,
+ * corrupt, from another format version or stale (the text file's size or
+ * mtime changed), it falls back to the wrapped text loader and rewrites the
+ * snapshot for the next run.
+ */
+class SnapshotTradeLoader : public ITradeLoader {
+private:
+    class Cursor;
+
+    SnapshottingTradeLoader fallback_;
+    bool lastLoadFromSnapshot_ = false;
+
+public:
+    explicit SnapshotTradeLoader(std::unique_ptr<ITradeLoader> textLoader);
+
+    std::unique_ptr<ITradeCursor> openCursor() override;
+    std::vector<ITrade*> loadTrades() override;
+    std::string getDataFile() const override;
+    void setDataFile(const std::string& file) override;
+
+    std::string getSnapshotFile() const;
+    void setSnapshotFile(const std::string& file);
+
+    // True when the most recent load was served from the snapshot.
+    bool lastLoadFromSnapshot() const;
+};
+
+#endif // SNAPSHOTTRADELOADER_H
@@ -0,0 +1,104 @@
+#include "SnapshottingTradeLoader.h"
+#include "TradeSnapshot.h"
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    /*
+     * The snapshot is only an accelerator for the next load, so failing to
+     * write it (full disk, unwritable directory) must not fail this one: the
+     * trades have already been parsed and are handed back regardless.
+     */
+    bool writeSnapshot(const TradeSnapshotBuilder& builder, const std::string& snapshotFile,
+                       const TradeSnapshot::SourceStamp& stamp) {
+        try {
+            builder.write(snapshotFile, stamp);
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Snapshot not written: " << e.what() << std::endl;
+            return false;
+        }
+    }
+}
+
+SnapshottingTradeLoader::SnapshottingTradeLoader(std::unique_ptr<ITradeLoader> source)
+    : source_(std::move(source)) {
+    if (!source_) {
+        throw std::invalid_argument("source loader cannot be null");
+    }
+}
+
+/*
+ * Cursor
+ *
+ * Passes batches through from the source cursor, copying each trade into the
+ * column builder on the way. The builder holds compact columns rather than
+ * trade objects, so streaming callers keep their bounded trade footprint.
+ */
+class SnapshottingTradeLoader::Cursor : public ITradeCursor {
+public:
+    Cursor(std::unique_ptr<ITradeCursor> source, std::string snapshotFile, TradeSnapshot::SourceStamp stamp)
+        : source_(std::move(source)), snapshotFile_(std::move(snapshotFile)), stamp_(stamp) {
+    }
+
+    std::size_t nextBatch(std::vector<ITrade*>& batch, std::size_t maxTrades) override {
+        const std::size_t start = batch.size();
+        std::size_t count = source_->nextBatch(batch, maxTrades);
+
+        for (std::size_t i = start; i < batch.size(); ++i) {
+            builder_.add(*batch[i]);
+        }
+
+        if (count == 0 && !written_) {
+            // Attempted once; a failure is logged and the cursor carries on.
+            writeSnapshot(builder_, snapshotFile_, stamp_);
+            written_ = true;
+        }
+        return count;
+    }
+
+private:
+    std::unique_ptr<ITradeCursor> source_;
+    std::string snapshotFile_;
+    TradeSnapshot::SourceStamp stamp_;
+    TradeSnapshotBuilder builder_;
+    bool written_ = false;
+};
+
+std::unique_ptr<ITradeCursor> SnapshottingTradeLoader::openCursor() {
+    // Stamp before parsing so a file modified mid-load is seen as stale next time.
+    TradeSnapshot::SourceStamp stamp = TradeSnapshot::stampOf(source_->getDataFile());
+    return std::make_unique<Cursor>(source_->openCursor(), getSnapshotFile(), stamp);
+}
+
+std::vector<ITrade*> SnapshottingTradeLoader::loadTrades() {
+    // Stamp before parsing so a file modified mid-load is seen as stale next time.
+    TradeSnapshot::SourceStamp stamp = TradeSnapshot::stampOf(source_->getDataFile());
+
+    std::vector<ITrade*> trades = source_->loadTrades();
+
+    TradeSnapshotBuilder builder;
+    for (const ITrade* trade : trades) {
+        builder.add(*trade);
+    }
+    writeSnapshot(builder, getSnapshotFile(), stamp);
+
+    return trades;
+}
+
+std::string SnapshottingTradeLoader::getDataFile() const {
+    return source_->getDataFile();
+}
+
+void SnapshottingTradeLoader::setDataFile(const std::string& file) {
+    source_->setDataFile(file);
+}
+
+std::string SnapshottingTradeLoader::getSnapshotFile() const {
+    return snapshotFile_.empty() ? source_->getDataFile() + ".snapshot" : snapshotFile_;
+}
+
+void SnapshottingTradeLoader::setSnapshotFile(const std::string& file) {
+    snapshotFile_ = file;
+}
@@ -0,0 +1,39 @@
+#ifndef SNAPSHOTTINGTRADELOADER_H
+#define SNAPSHOTTINGTRADELOADER_H
+
+#include "ITradeLoader.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * SnapshottingTradeLoader
+ *
+ * Decorates a text loader: trades are loaded from the wrapped loader as
+ * usual and, as a side effect, written out as a binary columnar snapshot
+ * (see TradeSnapshot.h) stamped with the source file's size and mtime.
+ * A snapshot that cannot be written is logged and skipped; the load itself
+ * still succeeds.
+ */
+class SnapshottingTradeLoader : public ITradeLoader {
+private:
+    class Cursor;
+
+    std::unique_ptr<ITradeLoader> source_;
+    std::string snapshotFile_;
+
+public:
+    explicit SnapshottingTradeLoader(std::unique_ptr<ITradeLoader> source);
+
+    // The snapshot is written once the cursor has been fully drained.
+    std::unique_ptr<ITradeCursor> openCursor() override;
+    std::vector<ITrade*> loadTrades() override;
+    std::string getDataFile() const override;
+    void setDataFile(const std::string& file) override;
+
+    // Defaults to "<data file>.snapshot" when not set explicitly.
+    std::string getSnapshotFile() const;
+    void setSnapshotFile(const std::string& file);
+};
+
+#endif // SNAPSHOTTINGTRADELOADER_H
@@ -0,0 +1,74 @@
+#include "TradeFieldParser.h"
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    std::string_view trim(std::string_view s) {
+        const char* ws = " \t\r\n";
+        auto b = s.find_first_not_of(ws);
+        if (b == std::string_view::npos) {
+            return std::string_view();
+        }
+        auto e = s.find_last_not_of(ws);
+        return s.substr(b, e - b + 1);
+    }
+
+    bool parseDigits(std::string_view text, std::size_t pos, std::size_t count, unsigned& value) {
+        value = 0;
+        for (std::size_t i = pos; i < pos + count; ++i) {
+            char c = text[i];
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned>(c - '0');
+        }
+        return true;
+    }
+
+    constexpr bool isLeapYear(unsigned year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    constexpr unsigned daysInMonth(unsigned year, unsigned month) {
+        constexpr unsigned days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+    }
+}
+
+std::chrono::system_clock::time_point TradeFieldParser::parseDate(std::string_view text) {
+    std::string_view date = trim(text);
+
+    unsigned year = 0;
+    unsigned month = 0;
+    unsigned day = 0;
+    if (date.size() != 10 || date[4] != '-' || date[7] != '-'
+        || !parseDigits(date, 0, 4, year)
+        || !parseDigits(date, 5, 2, month)
+        || !parseDigits(date, 8, 2, day)
+        || month < 1 || month > 12
+        || day < 1 || day > daysInMonth(year, month)) {
+        throw std::invalid_argument("Invalid date: " + std::string(text));
+    }
+
+    // Midnight UTC; deliberately independent of the host's timezone.
+    std::chrono::seconds sinceEpoch(daysFromCivil(static_cast<int>(year), month, day) * 86400LL);
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(sinceEpoch));
+}
+
+double TradeFieldParser::parseDouble(std::string_view text) {
+    std::string_view number = trim(text);
+    // std::from_chars does not accept an explicit '+' sign, std::stod did.
+    if (!number.empty() && number.front() == '+') {
+        number.remove_prefix(1);
+    }
+
+    double value = 0.0;
+    const char* end = number.data() + number.size();
+    auto parsed = std::from_chars(number.data(), end, value);
+    if (number.empty() || parsed.ec != std::errc() || parsed.ptr != end) {
+        throw std::invalid_argument("Invalid number: " + std::string(text));
+    }
+    return value;
+}
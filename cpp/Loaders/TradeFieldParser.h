@@ -0,0 +1,37 @@
+#ifndef TRADEFIELDPARSER_H
+#define TRADEFIELDPARSER_H
+
+#include <chrono>
+#include <string_view>
+
+/*
+ * TradeFieldParser
+ *
+ * Allocation-free, locale-independent field conversions for the trade loaders.
+ *
+ * Dates are ISO "YYYY-MM-DD" and are returned as midnight UTC. The day number
+ * is computed arithmetically (days-from-civil), so no std::tm, mktime, TZ
+ * database or locale lock is involved and a given file produces identical
+ * time points on every host and from every thread.
+ *
+ * Numbers go through std::from_chars, which ignores the global locale.
+ *
+ * All functions throw std::invalid_argument on malformed input.
+ */
+class TradeFieldParser {
+public:
+    static std::chrono::system_clock::time_point parseDate(std::string_view text);
+    static double parseDouble(std::string_view text);
+
+    // Days since 1970-01-01 for a proleptic Gregorian date.
+    static constexpr long long daysFromCivil(int year, unsigned month, unsigned day) {
+        year -= month <= 2 ? 1 : 0;
+        const long long era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(year - era * 400);
+        const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<long long>(doe) - 719468;
+    }
+};
+
+#endif // TRADEFIELDPARSER_H
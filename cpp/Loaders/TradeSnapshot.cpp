@@ -0,0 +1,243 @@
+#include "TradeSnapshot.h"
+#include "../Models/BondTrade.h"
+#include "../Models/FxTrade.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+    constexpr char Magic[8] = { 'T', 'R', 'D', 'S', 'N', 'A', 'P', '\0' };
+
+    constexpr std::uint64_t align8(std::uint64_t n) {
+        return (n + 7) & ~std::uint64_t(7);
+    }
+
+    std::uint64_t columnWidth(TradeSnapshot::Column c) {
+        switch (c) {
+        case TradeSnapshot::TradeDateColumn:
+        case TradeSnapshot::ValueDateColumn: return sizeof(std::int64_t);
+        case TradeSnapshot::NotionalColumn:
+        case TradeSnapshot::RateColumn: return sizeof(double);
+        case TradeSnapshot::KindColumn: return sizeof(std::uint8_t);
+        case TradeSnapshot::HeapColumn: return 0;
+        default: return sizeof(TradeSnapshot::StringRef);
+        }
+    }
+
+    // Fills columnOffsets and returns the total file size for the given shape.
+    std::uint64_t computeLayout(std::uint64_t rows, std::uint64_t heapSize, std::uint64_t (&offsets)[TradeSnapshot::ColumnCount]) {
+        std::uint64_t offset = align8(sizeof(TradeSnapshot::Header));
+        for (int c = 0; c < TradeSnapshot::ColumnCount; ++c) {
+            offsets[c] = offset;
+            std::uint64_t bytes = c == TradeSnapshot::HeapColumn
+                ? heapSize
+                : rows * columnWidth(static_cast<TradeSnapshot::Column>(c));
+            offset = align8(offset + bytes);
+        }
+        return offset;
+    }
+
+    std::int64_t toSeconds(std::chrono::system_clock::time_point tp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    }
+
+    std::chrono::system_clock::time_point fromSeconds(std::int64_t seconds) {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds(seconds)));
+    }
+
+    template <typename T>
+    void writeColumn(std::ofstream& out, const std::vector<T>& values, std::uint64_t offset) {
+        out.seekp(static_cast<std::streamoff>(offset));
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+}
+
+TradeSnapshot::SourceStamp TradeSnapshot::stampOf(const std::string& sourceFile) {
+    SourceStamp stamp;
+    std::error_code ec;
+    auto size = std::filesystem::file_size(sourceFile, ec);
+    if (ec) {
+        return stamp;
+    }
+    auto modified = std::filesystem::last_write_time(sourceFile, ec);
+    if (ec) {
+        return stamp;
+    }
+    stamp.size = static_cast<std::uint64_t>(size);
+    stamp.modified = static_cast<std::int64_t>(modified.time_since_epoch().count());
+    return stamp;
+}
+
+// FNV-1a over the header with the checksum field itself treated as zero.
+std::uint64_t TradeSnapshot::checksum(const Header& header) {
+    Header copy = header;
+    copy.checksum = 0;
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&copy);
+    for (std::size_t i = 0; i < sizeof(Header); ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+TradeSnapshot::StringRef TradeSnapshotBuilder::intern(const std::string& value) {
+    auto it = heapIndex_.find(value);
+    if (it != heapIndex_.end()) {
+        return it->second;
+    }
+
+    if (heap_.size() + value.size() > UINT32_MAX) {
+        throw std::runtime_error("Trade snapshot string heap exceeds 4GB");
+    }
+
+    TradeSnapshot::StringRef ref { static_cast<std::uint32_t>(heap_.size()), static_cast<std::uint32_t>(value.size()) };
+    heap_.append(value);
+    heapIndex_.emplace(value, ref);
+    return ref;
+}
+
+void TradeSnapshotBuilder::add(const ITrade& trade) {
+    bool fx = FxTrade::isFxTradeType(trade.getTradeTypeSymbol());
+
+    tradeDates_.push_back(toSeconds(trade.getTradeDate()));
+    valueDates_.push_back(toSeconds(trade.getValueDate()));
+    notionals_.push_back(trade.getNotional());
+    rates_.push_back(trade.getRate());
+    tradeIds_.push_back(intern(trade.getTradeId()));
+    tradeTypes_.push_back(intern(trade.getTradeType()));
+    instruments_.push_back(intern(trade.getInstrument()));
+    counterparties_.push_back(intern(trade.getCounterparty()));
+    kinds_.push_back(static_cast<std::uint8_t>(fx ? TradeSnapshot::TradeKind::Fx : TradeSnapshot::TradeKind::Bond));
+}
+
+void TradeSnapshotBuilder::write(const std::string& snapshotFile, const TradeSnapshot::SourceStamp& stamp) const {
+    TradeSnapshot::Header header {};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = TradeSnapshot::Version;
+    header.headerSize = sizeof(TradeSnapshot::Header);
+    header.sourceSize = stamp.size;
+    header.sourceModified = stamp.modified;
+    header.rowCount = kinds_.size();
+    header.heapSize = heap_.size();
+    header.fileSize = computeLayout(header.rowCount, header.heapSize, header.columnOffsets);
+    header.checksum = TradeSnapshot::checksum(header);
+
+    const std::string tempFile = snapshotFile + ".tmp";
+    {
+        std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Cannot write snapshot: " + tempFile);
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeColumn(out, tradeDates_, header.columnOffsets[TradeSnapshot::TradeDateColumn]);
+        writeColumn(out, valueDates_, header.columnOffsets[TradeSnapshot::ValueDateColumn]);
+        writeColumn(out, notionals_, header.columnOffsets[TradeSnapshot::NotionalColumn]);
+        writeColumn(out, rates_, header.columnOffsets[TradeSnapshot::RateColumn]);
+        writeColumn(out, tradeIds_, header.columnOffsets[TradeSnapshot::TradeIdColumn]);
+        writeColumn(out, tradeTypes_, header.columnOffsets[TradeSnapshot::TradeTypeColumn]);
+        writeColumn(out, instruments_, header.columnOffsets[TradeSnapshot::InstrumentColumn]);
+        writeColumn(out, counterparties_, header.columnOffsets[TradeSnapshot::CounterpartyColumn]);
+        writeColumn(out, kinds_, header.columnOffsets[TradeSnapshot::KindColumn]);
+        out.seekp(static_cast<std::streamoff>(header.columnOffsets[TradeSnapshot::HeapColumn]));
+        out.write(heap_.data(), static_cast<std::streamsize>(heap_.size()));
+
+        // Pad to the aligned size recorded in the header.
+        std::uint64_t written = header.columnOffsets[TradeSnapshot::HeapColumn] + heap_.size();
+        for (; written < header.fileSize; ++written) {
+            out.put('\0');
+        }
+
+        // Close first so a failure in the final flush is caught too.
+        out.close();
+        if (!out) {
+            std::error_code ignored;
+            std::filesystem::remove(tempFile, ignored);
+            throw std::runtime_error("Cannot write snapshot: " + tempFile);
+        }
+    }
+
+    std::filesystem::rename(tempFile, snapshotFile);
+}
+
+TradeSnapshotReader::TradeSnapshotReader(const std::string& snapshotFile, const TradeSnapshot::SourceStamp& expected) {
+    std::error_code ec;
+    if (!std::filesystem::exists(snapshotFile, ec)) {
+        return;
+    }
+
+    try {
+        file_ = std::make_unique<MappedFile>(snapshotFile);
+    } catch (const std::exception&) {
+        return;
+    }
+
+    if (file_->size() < sizeof(TradeSnapshot::Header)) {
+        return;
+    }
+    std::memcpy(&header_, file_->data(), sizeof(header_));
+
+    if (std::memcmp(header_.magic, Magic, sizeof(Magic)) != 0
+        || header_.version != TradeSnapshot::Version
+        || header_.headerSize != sizeof(TradeSnapshot::Header)
+        || header_.checksum != TradeSnapshot::checksum(header_)) {
+        return;
+    }
+
+    // Column offsets must be exactly what this version would have written.
+    std::uint64_t offsets[TradeSnapshot::ColumnCount];
+    std::uint64_t fileSize = computeLayout(header_.rowCount, header_.heapSize, offsets);
+    if (fileSize != header_.fileSize || fileSize != file_->size()
+        || std::memcmp(offsets, header_.columnOffsets, sizeof(offsets)) != 0) {
+        return;
+    }
+
+    TradeSnapshot::SourceStamp recorded { header_.sourceSize, header_.sourceModified };
+    if (!(recorded == expected)) {
+        return;
+    }
+
+    rowCount_ = static_cast<std::size_t>(header_.rowCount);
+    valid_ = true;
+}
+
+std::string TradeSnapshotReader::str(const TradeSnapshot::StringRef& ref) const {
+    if (static_cast<std::uint64_t>(ref.offset) + ref.length > header_.heapSize) {
+        throw std::runtime_error("Corrupt trade snapshot string reference");
+    }
+    return std::string(file_->data() + header_.columnOffsets[TradeSnapshot::HeapColumn] + ref.offset, ref.length);
+}
+
+ITrade* TradeSnapshotReader::createTrade(std::size_t row) const {
+    if (!valid_ || row >= rowCount_) {
+        throw std::out_of_range("Snapshot row out of range");
+    }
+
+    auto kind = static_cast<TradeSnapshot::TradeKind>(column<std::uint8_t>(TradeSnapshot::KindColumn)[row]);
+    std::string tradeId = str(column<TradeSnapshot::StringRef>(TradeSnapshot::TradeIdColumn)[row]);
+    std::string tradeType = str(column<TradeSnapshot::StringRef>(TradeSnapshot::TradeTypeColumn)[row]);
+    std::string instrument = str(column<TradeSnapshot::StringRef>(TradeSnapshot::InstrumentColumn)[row]);
+    std::string counterparty = str(column<TradeSnapshot::StringRef>(TradeSnapshot::CounterpartyColumn)[row]);
+
+    BaseTrade* trade = nullptr;
+    if (kind == TradeSnapshot::TradeKind::Fx) {
+        FxTrade* fx = new FxTrade(tradeId, tradeType);
+        fx->setValueDate(fromSeconds(column<std::int64_t>(TradeSnapshot::ValueDateColumn)[row]));
+        trade = fx;
+    } else {
+        trade = new BondTrade(tradeId, tradeType);
+    }
+
+    trade->setTradeDate(fromSeconds(column<std::int64_t>(TradeSnapshot::TradeDateColumn)[row]));
+    trade->setInstrument(instrument);
+    trade->setCounterparty(counterparty);
+    trade->setNotional(column<double>(TradeSnapshot::NotionalColumn)[row]);
+    trade->setRate(column<double>(TradeSnapshot::RateColumn)[row]);
+    return trade;
+}
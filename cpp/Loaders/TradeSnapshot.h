@@ -0,0 +1,137 @@
+#ifndef TRADESNAPSHOT_H
+#define TRADESNAPSHOT_H
+
+#include "MappedFile.h"
+#include "../Models/ITrade.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Binary columnar trade snapshot
+ *
+ * File layout (host byte order, every section 8-byte aligned):
+ *
+ *   Header           fixed size, see TradeSnapshot::Header
+ *   tradeDate        int64[rows]      seconds since epoch
+ *   valueDate        int64[rows]      seconds since epoch (FX only)
+ *   notional         double[rows]
+ *   rate             double[rows]
+ *   tradeId          StringRef[rows]  offset/length into the string heap
+ *   tradeType        StringRef[rows]
+ *   instrument       StringRef[rows]
+ *   counterparty     StringRef[rows]
+ *   kind             uint8[rows]      TradeKind
+ *   string heap      deduplicated bytes for every StringRef
+ *
+ * The header records the size and modification time of the text file the
+ * snapshot was built from; a snapshot whose stamp no longer matches is stale.
+ * The header carries its own checksum, and all offsets are bounds-checked
+ * against the file size before any row is read.
+ */
+class TradeSnapshot {
+public:
+    static constexpr std::uint32_t Version = 1;
+
+    enum class TradeKind : std::uint8_t { Bond = 0, Fx = 1 };
+
+    struct StringRef {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    // Identity of the text file a snapshot was built from.
+    struct SourceStamp {
+        std::uint64_t size = 0;
+        std::int64_t modified = 0;
+
+        bool operator==(const SourceStamp& other) const {
+            return size == other.size && modified == other.modified;
+        }
+    };
+
+    enum Column {
+        TradeDateColumn, ValueDateColumn, NotionalColumn, RateColumn,
+        TradeIdColumn, TradeTypeColumn, InstrumentColumn, CounterpartyColumn,
+        KindColumn, HeapColumn, ColumnCount
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        std::uint64_t sourceSize;
+        std::int64_t sourceModified;
+        std::uint64_t rowCount;
+        std::uint64_t heapSize;
+        std::uint64_t columnOffsets[ColumnCount];
+        std::uint64_t fileSize;
+        std::uint64_t checksum;
+    };
+
+    static SourceStamp stampOf(const std::string& sourceFile);
+    static std::uint64_t checksum(const Header& header);
+};
+
+/*
+ * TradeSnapshotBuilder
+ *
+ * Accumulates trades column by column and writes them out as a snapshot.
+ * Strings are interned into the heap, so repeated counterparties, trade
+ * types and currency pairs are stored once.
+ */
+class TradeSnapshotBuilder {
+public:
+    void add(const ITrade& trade);
+    std::size_t size() const { return kinds_.size(); }
+
+    // Writes to a temporary file and renames it into place.
+    void write(const std::string& snapshotFile, const TradeSnapshot::SourceStamp& stamp) const;
+
+private:
+    TradeSnapshot::StringRef intern(const std::string& value);
+
+    std::vector<std::int64_t> tradeDates_;
+    std::vector<std::int64_t> valueDates_;
+    std::vector<double> notionals_;
+    std::vector<double> rates_;
+    std::vector<TradeSnapshot::StringRef> tradeIds_;
+    std::vector<TradeSnapshot::StringRef> tradeTypes_;
+    std::vector<TradeSnapshot::StringRef> instruments_;
+    std::vector<TradeSnapshot::StringRef> counterparties_;
+    std::vector<std::uint8_t> kinds_;
+    std::string heap_;
+    std::unordered_map<std::string, TradeSnapshot::StringRef> heapIndex_;
+};
+
+/*
+ * TradeSnapshotReader
+ *
+ * Maps a snapshot and materializes trades straight from the columns.
+ * isValid() is false for a missing, corrupt, foreign-version or stale file.
+ */
+class TradeSnapshotReader {
+public:
+    TradeSnapshotReader(const std::string& snapshotFile, const TradeSnapshot::SourceStamp& expected);
+
+    bool isValid() const { return valid_; }
+    std::size_t size() const { return rowCount_; }
+    ITrade* createTrade(std::size_t row) const;
+
+private:
+    template <typename T>
+    const T* column(TradeSnapshot::Column c) const {
+        return reinterpret_cast<const T*>(file_->data() + header_.columnOffsets[c]);
+    }
+    std::string str(const TradeSnapshot::StringRef& ref) const;
+
+    std::unique_ptr<MappedFile> file_;
+    TradeSnapshot::Header header_ {};
+    std::size_t rowCount_ = 0;
+    bool valid_ = false;
+};
+
+#endif // TRADESNAPSHOT_H
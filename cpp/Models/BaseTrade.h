@@ -2,6 +2,7 @@
 #define BASETRADE_H
 
 #include "ITrade.h"
+#include "Symbol.h"
 #include <chrono>
 #include <string>
 
@@ -13,8 +14,8 @@ public:
     std::chrono::system_clock::time_point getTradeDate() const override { return tradeDate_; }
     void setTradeDate(const std::chrono::system_clock::time_point& date) override { tradeDate_ = date; }
     
-    std::string getInstrument() const override { return instrument_; }
-    void setInstrument(const std::string& instrument) override { instrument_ = instrument; }
+    std::string getInstrument() const override { return instrument_.str(); }
+    void setInstrument(const std::string& instrument) override { instrument_ = Symbol(instrument); }
     
     std::string getCounterparty() const override { return counterparty_; }
     void setCounterparty(const std::string& counterparty) override { counterparty_ = counterparty; }
@@ -28,12 +29,15 @@ public:
     std::string getTradeType() const override = 0;
     std::string getTradeId() const override { return tradeId_; }
     
+    Symbol getInstrumentSymbol() const override { return instrument_; }
+    std::string_view getTradeIdView() const override { return tradeId_; }
+    
 protected:
     std::string tradeId_;
     
 private:
     std::chrono::system_clock::time_point tradeDate_;
-    std::string instrument_;
+    Symbol instrument_;
     std::string counterparty_;
     double notional_ = 0.0;
     double rate_ = 0.0;
@@ -10,17 +10,18 @@ public:
     static constexpr const char* CorpBondTradeType = "CorpBond";
     
     BondTrade(const std::string& tradeId, const std::string& tradeType = GovBondTradeType) 
-        : tradeType_(tradeType) {
+        : tradeType_(Symbol(tradeType)) {
         if (tradeId.empty()) {
             throw std::invalid_argument("A valid non null, non empty trade ID must be provided");
         }
         tradeId_ = tradeId;
     }
     
-    std::string getTradeType() const override { return tradeType_; }
+    std::string getTradeType() const override { return tradeType_.str(); }
+    Symbol getTradeTypeSymbol() const override { return tradeType_; }
     
 private:
-    std::string tradeType_;
+    Symbol tradeType_;
 };
 
 #endif // BONDTRADE_H
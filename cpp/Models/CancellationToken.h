@@ -0,0 +1,77 @@
+#ifndef CANCELLATIONTOKEN_H
+#define CANCELLATIONTOKEN_H
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+/*
+ * CancellationToken
+ *
+ * Signals that a pricing run should stop: either cancel() was called or the
+ * optional deadline has passed. Copies share state, so the caller can keep
+ * one copy to cancel a run that was handed another. A default-constructed
+ * token never fires on its own.
+ *
+ * sleepFor is the interruptible replacement for std::this_thread::sleep_for
+ * and returns early as soon as the token fires.
+ */
+class CancellationToken {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CancellationToken() : state_(std::make_shared<State>()) {}
+
+    static CancellationToken withDeadline(Clock::time_point deadline) {
+        CancellationToken token;
+        token.state_->hasDeadline = true;
+        token.state_->deadline = deadline;
+        return token;
+    }
+
+    static CancellationToken withTimeout(Clock::duration timeout) {
+        return withDeadline(Clock::now() + timeout);
+    }
+
+    void cancel() const {
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            state_->cancelled = true;
+        }
+        state_->wake.notify_all();
+    }
+
+    bool isCancelled() const {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->cancelled || (state_->hasDeadline && Clock::now() >= state_->deadline);
+    }
+
+    bool hasDeadline() const { return state_->hasDeadline; }
+    Clock::time_point getDeadline() const { return state_->deadline; }
+
+    // Returns true if the full duration elapsed, false if the token fired first.
+    template <typename Rep, typename Period>
+    bool sleepFor(std::chrono::duration<Rep, Period> duration) const {
+        Clock::time_point until = Clock::now() + std::chrono::duration_cast<Clock::duration>(duration);
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        if (state_->hasDeadline && state_->deadline < until) {
+            state_->wake.wait_until(lock, state_->deadline, [this]() { return state_->cancelled; });
+            return false;
+        }
+        return !state_->wake.wait_until(lock, until, [this]() { return state_->cancelled; });
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool cancelled = false;
+        bool hasDeadline = false;
+        Clock::time_point deadline;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+#endif // CANCELLATIONTOKEN_H
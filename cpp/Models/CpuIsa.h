@@ -0,0 +1,56 @@
+#ifndef CPUISA_H
+#define CPUISA_H
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define CPUISA_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// AVX2 code is compiled per function so the rest of the build stays baseline x86-64.
+#define CPUISA_AVX2 1
+#define CPUISA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/*
+ * CpuIsa
+ *
+ * The vector instruction sets the SIMD kernels are written for, and which of
+ * them this CPU can run. Detection happens once per process. CPUISA_SSE2 and
+ * CPUISA_AVX2 say which kernels this target can compile; a kernel built for
+ * an instruction set detect() cannot return must never be called.
+ */
+class CpuIsa {
+public:
+    enum class Isa { Scalar, Sse2, Avx2 };
+
+    static Isa detect() {
+        static const Isa detected = [] {
+#ifdef CPUISA_AVX2
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return Isa::Avx2;
+#endif
+#ifdef CPUISA_SSE2
+            return Isa::Sse2;
+#else
+            return Isa::Scalar;
+#endif
+        }();
+        return detected;
+    }
+
+    // The requested instruction set, downgraded if the CPU lacks it.
+    static Isa supported(Isa requested) {
+        Isa best = detect();
+        return static_cast<int>(requested) > static_cast<int>(best) ? best : requested;
+    }
+
+    static const char* name(Isa isa) {
+        switch (isa) {
+        case Isa::Avx2: return "AVX2";
+        case Isa::Sse2: return "SSE2";
+        default: return "scalar";
+        }
+    }
+};
+
+#endif // CPUISA_H
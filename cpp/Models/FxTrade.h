@@ -9,23 +9,32 @@ class FxTrade : public BaseTrade {
 public:
     static constexpr const char* FxSpotTradeType = "FxSpot";
     static constexpr const char* FxForwardTradeType = "FxFwd";
+
+    // True for the trade types an FxTrade carries, whatever ITrade holds them.
+    static bool isFxTradeType(Symbol tradeType) {
+        static const Symbol spot(FxSpotTradeType);
+        static const Symbol forward(FxForwardTradeType);
+        return tradeType == spot || tradeType == forward;
+    }
     
     FxTrade(const std::string& tradeId = "", const std::string& tradeType = FxSpotTradeType)
-        : tradeType_(tradeType) {
+        : tradeType_(Symbol(tradeType)) {
         if (!tradeId.empty()) {
             tradeId_ = tradeId;
         }
     }
     
     std::string getTradeType() const override {
-        return tradeType_;
+        return tradeType_.str();
     }
     
-    std::chrono::system_clock::time_point getValueDate() const { return valueDate_; }
+    Symbol getTradeTypeSymbol() const override { return tradeType_; }
+    
+    std::chrono::system_clock::time_point getValueDate() const override { return valueDate_; }
     void setValueDate(const std::chrono::system_clock::time_point& date) { valueDate_ = date; }
     
 private:
-    std::string tradeType_;
+    Symbol tradeType_;
     std::chrono::system_clock::time_point valueDate_;
 };
 
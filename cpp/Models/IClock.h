@@ -0,0 +1,26 @@
+#ifndef ICLOCK_H
+#define ICLOCK_H
+
+#include "CancellationToken.h"
+#include <chrono>
+
+/*
+ * IClock
+ *
+ * Time source for anything that waits on simulated backend latency.
+ * SystemClock really sleeps; VirtualClock only moves a counter, so code
+ * written against IClock can be run in virtual time.
+ */
+class IClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    virtual ~IClock() = default;
+
+    virtual Clock::time_point now() const = 0;
+
+    // Waits for the duration; returns false if the token fired first.
+    virtual bool sleepFor(Clock::duration duration, const CancellationToken& token) = 0;
+};
+
+#endif // ICLOCK_H
@@ -3,11 +3,59 @@
 
 #include "ITrade.h"
 #include "IScalarResultReceiver.h"
+#include "CancellationToken.h"
+#include "ResultRecord.h"
+#include <span>
+#include <string>
+#include <vector>
 
+// ParallelPricer and StreamingTradeLoader share one engine per trade type
+// across their worker threads, so price and priceBatch must be safe to call
+// concurrently on the same instance.
 class IPricingEngine {
 public:
     virtual ~IPricingEngine() = default;
     virtual void price(ITrade* trade, IScalarResultReceiver* resultReceiver) = 0;
+
+    // Prices several trades in one call so an engine can pay its setup cost
+    // once per batch. The default simply prices them one at a time.
+    virtual void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) {
+        for (ITrade* trade : trades) {
+            price(trade, resultReceiver);
+        }
+    }
+
+    // Cancellable variant. Trades the engine has not priced by the time the
+    // token fires are reported with ResultCode::Timeout, so every trade in
+    // the batch still gets exactly one outcome. The default checks the
+    // token between trades.
+    virtual void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver,
+                            const CancellationToken& token) {
+        for (std::size_t i = 0; i < trades.size(); ++i) {
+            if (token.isCancelled()) {
+                reportTimeouts(trades.subspan(i), resultReceiver);
+                return;
+            }
+            price(trades[i], resultReceiver);
+        }
+    }
+
+    // Fingerprint of everything other than the trade that the engine's
+    // results depend on: model version, market data, seed. Cached results
+    // are only reused while it is unchanged. Empty for an engine that does
+    // not supply one.
+    virtual std::string getCacheTag() const {
+        return std::string();
+    }
+
+    static void reportTimeouts(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) {
+        std::vector<ResultRecord> records;
+        records.reserve(trades.size());
+        for (ITrade* trade : trades) {
+            records.push_back(ResultRecord { trade->getTradeIdView(), 0.0, ResultCode::Timeout, "" });
+        }
+        resultReceiver->addResults(records);
+    }
 };
 
 #endif // IPRICINGENGINE_H
@@ -1,6 +1,8 @@
 #ifndef ISCALARRESULTRECEIVER_H
 #define ISCALARRESULTRECEIVER_H
 
+#include "ResultRecord.h"
+#include <span>
 #include <string>
 
 class IScalarResultReceiver {
@@ -8,7 +10,20 @@ public:
     virtual ~IScalarResultReceiver() = default;
     virtual void addResult(const std::string& tradeId, double result) = 0;
     virtual void addError(const std::string& tradeId, const std::string& error) = 0;
+
+    // Batched delivery. The default forwards each record to addResult and/or
+    // addError; receivers with per-call overhead should override it.
+    virtual void addResults(std::span<const ResultRecord> records) {
+        for (const ResultRecord& record : records) {
+            std::string tradeId(record.tradeId);
+            if (record.hasValue()) {
+                addResult(tradeId, record.value);
+            }
+            if (record.hasError()) {
+                addError(tradeId, std::string(record.error()));
+            }
+        }
+    }
 };
 
 #endif // ISCALARRESULTRECEIVER_H
-
@@ -1,7 +1,9 @@
 #ifndef ITRADE_H
 #define ITRADE_H
 
+#include "Symbol.h"
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <memory>
 
@@ -23,9 +25,21 @@ public:
     
     virtual double getRate() const = 0;
     virtual void setRate(double rate) = 0;
+
+    // Settlement date of trades that have one (FX); the epoch otherwise.
+    virtual std::chrono::system_clock::time_point getValueDate() const {
+        return std::chrono::system_clock::time_point();
+    }
     
     virtual std::string getTradeType() const = 0;
     virtual std::string getTradeId() const = 0;
+
+    // Allocation-free accessors. Symbols compare and hash as integers, so
+    // engine lookup and grouping should prefer these over the string getters.
+    virtual Symbol getTradeTypeSymbol() const = 0;
+    virtual Symbol getInstrumentSymbol() const = 0;
+    // Valid until the trade is modified or destroyed.
+    virtual std::string_view getTradeIdView() const = 0;
 };
 
 #endif // ITRADE_H
@@ -0,0 +1,47 @@
+#include "ResultBatch.h"
+
+void ResultBatch::addResult(const std::string& tradeId, double result) {
+    entries_.push_back(Entry { tradeId, std::string(), result, ResultCode::Ok });
+}
+
+void ResultBatch::addError(const std::string& tradeId, const std::string& error) {
+    if (!entries_.empty()) {
+        Entry& last = entries_.back();
+        if (last.code == ResultCode::Ok && last.tradeId == tradeId) {
+            last.code = ResultCode::Warning;
+            last.detail = error;
+            return;
+        }
+    }
+    entries_.push_back(Entry { tradeId, error, 0.0, ResultCode::Error });
+}
+
+void ResultBatch::addResults(std::span<const ResultRecord> records) {
+    for (const ResultRecord& record : records) {
+        entries_.push_back(Entry { std::string(record.tradeId), std::string(record.detail), record.value, record.code });
+    }
+}
+
+void ResultBatch::flushTo(IScalarResultReceiver& target) {
+    if (entries_.empty()) {
+        return;
+    }
+
+    records_.clear();
+    records_.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        records_.push_back(ResultRecord { entry.tradeId, entry.value, entry.code, entry.detail });
+    }
+
+    // Clear before returning even if the target throws, so a retry does not
+    // deliver the same results twice.
+    try {
+        target.addResults(records_);
+    } catch (...) {
+        records_.clear();
+        entries_.clear();
+        throw;
+    }
+    records_.clear();
+    entries_.clear();
+}
@@ -0,0 +1,43 @@
+#ifndef RESULTBATCH_H
+#define RESULTBATCH_H
+
+#include "IScalarResultReceiver.h"
+#include "ResultRecord.h"
+#include <span>
+#include <string>
+#include <vector>
+
+/*
+ * ResultBatch
+ *
+ * Receiver that buffers results with owned strings and hands them on as a
+ * single addResults call. An addError that directly follows an addResult
+ * for the same trade is folded into that record as a Warning.
+ */
+class ResultBatch : public IScalarResultReceiver {
+public:
+    void addResult(const std::string& tradeId, double result) override;
+    void addError(const std::string& tradeId, const std::string& error) override;
+    void addResults(std::span<const ResultRecord> records) override;
+
+    std::size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+    void clear() { entries_.clear(); }
+    void swap(ResultBatch& other) { entries_.swap(other.entries_); }
+
+    // Delivers everything buffered in one addResults call, then clears.
+    void flushTo(IScalarResultReceiver& target);
+
+private:
+    struct Entry {
+        std::string tradeId;
+        std::string detail;
+        double value;
+        ResultCode code;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<ResultRecord> records_;
+};
+
+#endif // RESULTBATCH_H
@@ -0,0 +1,49 @@
+#ifndef RESULTRECORD_H
+#define RESULTRECORD_H
+
+#include <cstdint>
+#include <string_view>
+
+enum class ResultCode : std::uint8_t {
+    Ok = 0,                 // value only
+    Warning,                // value plus a message in detail
+    Error,                  // no value; message in detail
+    UnsupportedTradeType,   // no value
+    NoPricingEngine,        // no value
+    Timeout                 // no value; the run was cancelled or hit its deadline
+};
+
+/*
+ * ResultRecord
+ *
+ * One entry of a batched result delivery. The views are only valid for the
+ * duration of the IScalarResultReceiver::addResults call that carries them;
+ * receivers that keep results must copy.
+ *
+ * detail overrides the code's standard message when non-empty.
+ */
+struct ResultRecord {
+    std::string_view tradeId;
+    double value = 0.0;
+    ResultCode code = ResultCode::Ok;
+    std::string_view detail;
+
+    static bool hasValue(ResultCode code) {
+        return code == ResultCode::Ok || code == ResultCode::Warning;
+    }
+
+    static std::string_view message(ResultCode code) {
+        switch (code) {
+        case ResultCode::UnsupportedTradeType: return "Trade type not supported";
+        case ResultCode::NoPricingEngine: return "No Pricing Engines available for this trade type";
+        case ResultCode::Timeout: return "Pricing timed out before the trade was priced";
+        default: return std::string_view();
+        }
+    }
+
+    bool hasValue() const { return hasValue(code); }
+    bool hasError() const { return code != ResultCode::Ok; }
+    std::string_view error() const { return detail.empty() ? message(code) : detail; }
+};
+
+#endif // RESULTRECORD_H
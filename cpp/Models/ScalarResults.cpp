@@ -1,4 +1,6 @@
 #include "ScalarResults.h"
+#include <algorithm>
+#include <functional>
 #include <stdexcept>
 
 /*ScalarResults::~ScalarResults() = default;
@@ -58,108 +60,138 @@ ScalarResults::Iterator ScalarResults::end() const {
 
 //==========================
 
-/*
- * Destructor
- * Nothing special to clean up.
-*/ 
+namespace {
+    constexpr std::size_t InitialCapacity = 16;
+}
+
 ScalarResults::~ScalarResults() = default;
 
+std::uint32_t ScalarResults::hashOf(std::string_view tradeId) {
+    std::size_t h = std::hash<std::string_view>()(tradeId);
+    return static_cast<std::uint32_t>(h ^ (h >> 32));
+}
+
 /*
- * operator[]
+ * find
  *
- * Reuse:
- * This function already merges results_ and errors_ into a ScalarResult.
- * The iterator will reuse this instead of duplicating merge logic.
+ * Linear probe from the home slot until the id or an empty slot is found.
+ * The table is never more than 70% full, so an empty slot always exists.
  */
-std::optional<ScalarResult> ScalarResults::operator[](const std::string& tradeId) const {
-    if (!containsTrade(tradeId)) {
-        return std::nullopt;
+const ScalarResults::Record* ScalarResults::find(std::string_view tradeId) const {
+    if (slots_.empty()) {
+        return nullptr;
     }
 
-    std::optional<double> value;
-    std::optional<std::string> error;
+    std::uint32_t hash = hashOf(tradeId);
+    std::size_t mask = slots_.size() - 1;
+    for (std::size_t i = hash & mask; ; i = (i + 1) & mask) {
+        const Slot& slot = slots_[i];
+        if (slot.record == 0) {
+            return nullptr;
+        }
+        if (slot.hash == hash && records_[slot.record - 1].tradeId == tradeId) {
+            return &records_[slot.record - 1];
+        }
+    }
+}
 
-    auto rIt = results_.find(tradeId);
-    if (rIt != results_.end()) {
-        value = rIt->second;
+ScalarResults::Record& ScalarResults::findOrInsert(std::string_view tradeId) {
+    if ((records_.size() + 1) * 10 > slots_.size() * 7) {
+        rehash(slots_.empty() ? InitialCapacity : slots_.size() * 2);
     }
 
-    auto eIt = errors_.find(tradeId);
-    if (eIt != errors_.end()) {
-        error = eIt->second;
+    std::uint32_t hash = hashOf(tradeId);
+    std::size_t mask = slots_.size() - 1;
+    std::size_t i = hash & mask;
+    for (; slots_[i].record != 0; i = (i + 1) & mask) {
+        if (slots_[i].hash == hash && records_[slots_[i].record - 1].tradeId == tradeId) {
+            return records_[slots_[i].record - 1];
+        }
     }
 
-    return ScalarResult(tradeId, value, error);
+    records_.emplace_back();
+    records_.back().tradeId.assign(tradeId.data(), tradeId.size());
+    slots_[i].hash = hash;
+    slots_[i].record = static_cast<std::uint32_t>(records_.size());
+    return records_.back();
+}
+
+void ScalarResults::rehash(std::size_t capacity) {
+    std::vector<Slot> slots(capacity);
+    std::size_t mask = capacity - 1;
+    for (const Slot& slot : slots_) {
+        if (slot.record == 0) {
+            continue;
+        }
+        std::size_t i = slot.hash & mask;
+        while (slots[i].record != 0) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = slot;
+    }
+    slots_.swap(slots);
+}
+
+ScalarResult ScalarResults::toResult(const Record& record) const {
+    std::optional<double> value;
+    std::optional<std::string> error;
+    if (record.hasValue) {
+        value = record.value;
+    }
+    if (record.hasError) {
+        error = record.error;
+    }
+    return ScalarResult(record.tradeId, value, error);
+}
+
+std::optional<ScalarResult> ScalarResults::operator[](const std::string& tradeId) const {
+    const Record* record = find(tradeId);
+    if (record == nullptr) {
+        return std::nullopt;
+    }
+    return toResult(*record);
 }
 
-/*
- * containsTrade
- *
- * Simple helper reused by operator[].
- */
 bool ScalarResults::containsTrade(const std::string& tradeId) const {
-    return results_.find(tradeId) != results_.end()
-        || errors_.find(tradeId) != errors_.end();
+    return find(tradeId) != nullptr;
 }
 
-/*
- * addResult
- *
- * Stores a successful pricing result.
- */
 void ScalarResults::addResult(const std::string& tradeId, double result) {
-    results_[tradeId] = result;
+    Record& record = findOrInsert(tradeId);
+    record.value = result;
+    record.hasValue = true;
 }
 
-/*
- * addError
- *
- * Stores a pricing error.
- */
 void ScalarResults::addError(const std::string& tradeId, const std::string& error) {
-    errors_[tradeId] = error;
+    Record& record = findOrInsert(tradeId);
+    record.error = error;
+    record.hasError = true;
 }
 
-/*
- * getAllTradeIds
- *
- * Reuse helper for Exercise 5:
- * Builds a list of unique tradeIds from results_ and errors_.
- * This avoids duplicating logic inside the iterator.
- */
-std::vector<std::string> ScalarResults::getAllTradeIds() const {
-    std::vector<std::string> ids;
-
-    // First add tradeIds that have results
-    for (const auto& r : results_) {
-        ids.push_back(r.first);
-    }
-
-    // Then add tradeIds that only have errors
-    for (const auto& e : errors_) {
-        if (results_.find(e.first) == results_.end()) {
-            ids.push_back(e.first);
+void ScalarResults::addResults(std::span<const ResultRecord> records) {
+    for (const ResultRecord& result : records) {
+        Record& record = findOrInsert(result.tradeId);
+        if (result.hasValue()) {
+            record.value = result.value;
+            record.hasValue = true;
+        }
+        if (result.hasError()) {
+            std::string_view error = result.error();
+            record.error.assign(error.data(), error.size());
+            record.hasError = true;
         }
     }
-
-    return ids;
 }
 
 /*
- * ===== Iterator implementation (Exercise 5) =====
- *
- * Purpose:
- * Allow ScalarResults to be used in a range-for loop.
+ * ===== Iterator =====
  *
- * Reuse strategy:
- * - Use existing storage (results_ and errors_)
- * - Use getAllTradeIds() to enumerate tradeIds
- * - Use operator[] to build ScalarResult
- * No logic is duplicated.
+ * Each step is an index increment; dereferencing builds the ScalarResult
+ * straight from one record.
  */
 
-ScalarResults::Iterator::Iterator(const ScalarResults* parent, size_t index)
-    : parent_(parent), index_(index) {}
+ScalarResults::Iterator::Iterator(const ScalarResults* parent, const std::vector<std::uint32_t>* order, size_t index)
+    : parent_(parent), order_(order), index_(index) {}
 
 ScalarResults::Iterator& ScalarResults::Iterator::operator++() {
     ++index_;
@@ -167,26 +199,29 @@ ScalarResults::Iterator& ScalarResults::Iterator::operator++() {
 }
 
 ScalarResult ScalarResults::Iterator::operator*() const {
-    // Reuse: delegate ScalarResult creation to operator[]
-    auto ids = parent_->getAllTradeIds();
-    return parent_->operator[](ids[index_]).value();
+    std::size_t record = order_ != nullptr ? (*order_)[index_] : index_;
+    return parent_->toResult(parent_->records_[record]);
 }
 
 bool ScalarResults::Iterator::operator!=(const Iterator& other) const {
-    // Range-for only checks against end()
     return index_ != other.index_;
 }
 
-/*
- * begin / end
- *
- * Entry points for range-for iteration.
- */
 ScalarResults::Iterator ScalarResults::begin() const {
-    return Iterator(this, 0);
+    return Iterator(this, nullptr, 0);
 }
 
 ScalarResults::Iterator ScalarResults::end() const {
-    return Iterator(this, getAllTradeIds().size());
+    return Iterator(this, nullptr, records_.size());
 }
 
+ScalarResults::SortedView::SortedView(const ScalarResults* parent) : parent_(parent) {
+    order_.resize(parent->records_.size());
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+        order_[i] = static_cast<std::uint32_t>(i);
+    }
+    const auto& records = parent->records_;
+    std::sort(order_.begin(), order_.end(), [&records](std::uint32_t a, std::uint32_t b) {
+        return records[a].tradeId < records[b].tradeId;
+    });
+}
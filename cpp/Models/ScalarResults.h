@@ -50,54 +50,108 @@ private:
 #include "IScalarResultReceiver.h"
 #include "ScalarResult.h"
 
-#include <map>
+#include <cstdint>
 #include <vector>
 #include <optional>
+#include <span>
 #include <string>
-
+#include <string_view>
+
+/*
+ * ScalarResults
+ *
+ * One flat Record per trade holds both the value and the error, stored in
+ * insertion order. An open-addressing index (linear probing, cached hashes)
+ * maps trade ids to records, so addResult/addError/lookup are O(1) expected
+ * and iteration is a linear scan over the records.
+ *
+ * Iteration order is the order in which trades were first reported. Use
+ * sorted() when output must not depend on pricing order.
+ */
 class ScalarResults : public IScalarResultReceiver {
 public:
+    virtual ~ScalarResults();
 
-     virtual ~ScalarResults();
-    // Reuse: already-existing merge logic for results + errors
     std::optional<ScalarResult> operator[](const std::string& tradeId) const;
 
     bool containsTrade(const std::string& tradeId) const;
-    // Reuse: existing insertion points used by pricing system
-    void addResult(const std::string& tradeId, double result);
-    void addError(const std::string& tradeId, const std::string& error);
+    std::size_t size() const { return records_.size(); }
+
+    // A later call for the same trade overwrites the earlier value/error.
+    void addResult(const std::string& tradeId, double result) override;
+    void addError(const std::string& tradeId, const std::string& error) override;
+    // One index probe per record instead of one per addResult/addError.
+    void addResults(std::span<const ResultRecord> records) override;
 
     /*
      * Iterator
      *
-     * Simple forward iterator so ScalarResults can be used in range-for.
-     * It reuses existing storage (results_ / errors_) and operator[].
+     * Forward iterator over records. When order is set it walks the given
+     * record indices instead of insertion order.
      */
     class Iterator {
     public:
-        Iterator(const ScalarResults* parent, size_t index);
+        Iterator(const ScalarResults* parent, const std::vector<std::uint32_t>* order, size_t index);
 
         Iterator& operator++();
         ScalarResult operator*() const;
         bool operator!=(const Iterator& other) const;
 
     private:
-        // Reuse: iterator only stores parent + index
         const ScalarResults* parent_;
+        const std::vector<std::uint32_t>* order_;
         size_t index_;
     };
 
-    // Entry points for range-for
+    /*
+     * SortedView
+     *
+     * Snapshot of the record order sorted by trade id. Valid until the
+     * next addResult/addError on the parent.
+     */
+    class SortedView {
+    public:
+        explicit SortedView(const ScalarResults* parent);
+
+        Iterator begin() const { return Iterator(parent_, &order_, 0); }
+        Iterator end() const { return Iterator(parent_, &order_, order_.size()); }
+        std::size_t size() const { return order_.size(); }
+
+    private:
+        const ScalarResults* parent_;
+        std::vector<std::uint32_t> order_;
+    };
+
+    // Entry points for range-for (insertion order)
     Iterator begin() const;
     Iterator end() const;
 
+    SortedView sorted() const { return SortedView(this); }
+
 private:
-    // Existing storage (unchanged)
-    std::map<std::string, double> results_;
-    std::map<std::string, std::string> errors_;
+    struct Record {
+        std::string tradeId;
+        std::string error;
+        double value = 0.0;
+        bool hasValue = false;
+        bool hasError = false;
+    };
+
+    // Index slot: record index + 1 (0 marks an empty slot) and the full hash,
+    // so probes rarely have to touch the record to compare ids.
+    struct Slot {
+        std::uint32_t hash = 0;
+        std::uint32_t record = 0;
+    };
+
+    std::vector<Record> records_;
+    std::vector<Slot> slots_;
 
-    // Reuse helper: builds union of tradeIds from results_ and errors_
-    std::vector<std::string> getAllTradeIds() const;
+    static std::uint32_t hashOf(std::string_view tradeId);
+    const Record* find(std::string_view tradeId) const;
+    Record& findOrInsert(std::string_view tradeId);
+    void rehash(std::size_t capacity);
+    ScalarResult toResult(const Record& record) const;
 };
 
 #endif // SCALARRESULTS_H
@@ -0,0 +1,42 @@
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+ * StringPool
+ *
+ * Stores each distinct string once and hands out a compact integer id for it.
+ * Views returned by view() stay valid for the lifetime of the pool.
+ * Not thread-safe.
+ */
+class StringPool {
+public:
+    using Id = std::uint32_t;
+
+    Id intern(std::string_view value) {
+        auto it = index_.find(value);
+        if (it != index_.end()) {
+            return it->second;
+        }
+
+        Id id = static_cast<Id>(strings_.size());
+        // deque keeps element addresses stable, so the key view stays valid.
+        const std::string& stored = strings_.emplace_back(value);
+        index_.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    std::string_view view(Id id) const { return strings_[id]; }
+    std::size_t size() const { return strings_.size(); }
+
+private:
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, Id> index_;
+};
+
+#endif // STRINGPOOL_H
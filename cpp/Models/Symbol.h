@@ -0,0 +1,56 @@
+#ifndef SYMBOL_H
+#define SYMBOL_H
+
+#include "SymbolTable.h"
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/*
+ * Symbol
+ *
+ * Compact handle on a string interned in the process-wide SymbolTable.
+ * Comparing or hashing two symbols compares their ids, never the text.
+ * A default-constructed Symbol is the empty string.
+ */
+class Symbol {
+public:
+    Symbol() = default;
+    explicit Symbol(std::string_view value) : id_(SymbolTable::instance().intern(value)) {}
+
+    // id must have come from a Symbol created earlier in this process.
+    static Symbol fromId(std::uint32_t id) {
+        Symbol symbol;
+        symbol.id_ = id;
+        return symbol;
+    }
+
+    std::uint32_t id() const { return id_; }
+    bool empty() const { return id_ == 0; }
+    std::string_view view() const { return SymbolTable::instance().view(id_); }
+    std::string str() const { return std::string(view()); }
+
+    bool operator==(const Symbol& other) const { return id_ == other.id_; }
+    bool operator!=(const Symbol& other) const { return id_ != other.id_; }
+    bool operator<(const Symbol& other) const { return id_ < other.id_; }
+
+private:
+    std::uint32_t id_ = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& out, const Symbol& symbol) {
+    return out << symbol.view();
+}
+
+namespace std {
+    template <>
+    struct hash<Symbol> {
+        std::size_t operator()(const Symbol& symbol) const noexcept {
+            return std::hash<std::uint32_t>()(symbol.id());
+        }
+    };
+}
+
+#endif // SYMBOL_H
@@ -0,0 +1,56 @@
+#include "SymbolTable.h"
+#include <stdexcept>
+#include <string>
+
+SymbolTable& SymbolTable::instance() {
+    // Never destroyed, so symbols held by other statics stay valid during
+    // process shutdown.
+    static SymbolTable* table = new SymbolTable();
+    return *table;
+}
+
+SymbolTable::SymbolTable() {
+    intern(std::string_view());
+}
+
+std::uint32_t SymbolTable::intern(std::string_view value) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = index_.find(value);
+        if (it != index_.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = index_.find(value);
+    if (it != index_.end()) {
+        return it->second;
+    }
+
+    std::uint32_t id = size_.load(std::memory_order_relaxed);
+    std::size_t chunk = id >> ChunkBits;
+    if (chunk >= MaxChunks) {
+        throw std::length_error("SymbolTable is full (" + std::to_string(MaxChunks * ChunkSize) + " symbols)");
+    }
+
+    std::string* strings = chunks_[chunk].load(std::memory_order_relaxed);
+    if (strings == nullptr) {
+        strings = new std::string[ChunkSize];
+        chunks_[chunk].store(strings, std::memory_order_release);
+    }
+
+    std::string& stored = strings[id & (ChunkSize - 1)];
+    stored.assign(value.data(), value.size());
+    index_.emplace(std::string_view(stored), id);
+    size_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+std::string_view SymbolTable::view(std::uint32_t id) const {
+    if (id >= size()) {
+        throw std::out_of_range("Unknown symbol id");
+    }
+    const std::string* strings = chunks_[id >> ChunkBits].load(std::memory_order_acquire);
+    return strings[id & (ChunkSize - 1)];
+}
@@ -0,0 +1,55 @@
+#ifndef SYMBOLTABLE_H
+#define SYMBOLTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+ * SymbolTable
+ *
+ * Process-wide interning of repeated strings from small, bounded domains
+ * (trade types, instruments). Each distinct value is stored once and
+ * identified by a dense 32-bit id; id 0 is always the empty string.
+ *
+ * Entries are never freed and the table holds at most MaxChunks * ChunkSize
+ * (about four million) values; intern() throws std::length_error beyond
+ * that. Open-ended values - trade ids, counterparties - belong in a
+ * StringPool owned by whatever holds them, so a long-running follow does
+ * not grow the table without limit.
+ *
+ * intern() takes a shared lock on the hit path and an exclusive lock only
+ * when a new value is added. view() is lock-free: strings live in fixed-size
+ * chunks that are never moved or freed, so an id handed out once stays
+ * readable for the life of the process.
+ */
+class SymbolTable {
+public:
+    static SymbolTable& instance();
+
+    std::uint32_t intern(std::string_view value);
+    std::string_view view(std::uint32_t id) const;
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+private:
+    static constexpr std::size_t ChunkBits = 10;
+    static constexpr std::size_t ChunkSize = std::size_t(1) << ChunkBits;
+    static constexpr std::size_t MaxChunks = 4096;
+
+    SymbolTable();
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string_view, std::uint32_t> index_;
+    std::atomic<std::string*> chunks_[MaxChunks] {};
+    std::atomic<std::uint32_t> size_ { 0 };
+};
+
+#endif // SYMBOLTABLE_H
@@ -0,0 +1,23 @@
+#ifndef SYSTEMCLOCK_H
+#define SYSTEMCLOCK_H
+
+#include "IClock.h"
+
+// Wall-clock time; waits block the calling thread.
+class SystemClock : public IClock {
+public:
+    static SystemClock& instance() {
+        static SystemClock clock;
+        return clock;
+    }
+
+    Clock::time_point now() const override {
+        return Clock::now();
+    }
+
+    bool sleepFor(Clock::duration duration, const CancellationToken& token) override {
+        return token.sleepFor(duration);
+    }
+};
+
+#endif // SYSTEMCLOCK_H
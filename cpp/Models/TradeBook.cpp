@@ -0,0 +1,76 @@
+#include "TradeBook.h"
+#include "TradeBookTrade.h"
+#include "FxTrade.h"
+#include <stdexcept>
+
+namespace {
+    constexpr std::int64_t SecondsPerDay = 86400;
+}
+
+TradeBook::~TradeBook() = default;
+
+std::int32_t TradeBook::toDays(const std::chrono::system_clock::time_point& date) {
+    std::int64_t seconds = std::chrono::duration_cast<std::chrono::seconds>(date.time_since_epoch()).count();
+    // Floor division so dates before 1970 still land on their own day.
+    std::int64_t days = seconds / SecondsPerDay;
+    if (seconds % SecondsPerDay < 0) {
+        --days;
+    }
+    if (days < INT32_MIN || days > INT32_MAX) {
+        throw std::out_of_range("Trade date outside the TradeBook day range");
+    }
+    return static_cast<std::int32_t>(days);
+}
+
+std::chrono::system_clock::time_point TradeBook::fromDays(std::int32_t days) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::seconds(static_cast<std::int64_t>(days) * SecondsPerDay)));
+}
+
+void TradeBook::reserve(std::size_t rows) {
+    notionals_.reserve(rows);
+    rates_.reserve(rows);
+    tradeDays_.reserve(rows);
+    valueDays_.reserve(rows);
+    tradeIds_.reserve(rows);
+    tradeTypes_.reserve(rows);
+    instruments_.reserve(rows);
+    counterparties_.reserve(rows);
+    kinds_.reserve(rows);
+}
+
+std::size_t TradeBook::add(const ITrade& trade) {
+    bool fx = FxTrade::isFxTradeType(trade.getTradeTypeSymbol());
+
+    // Convert everything before touching the columns so a throw leaves the
+    // book unchanged (interned strings are harmless).
+    std::int32_t tradeDay = toDays(trade.getTradeDate());
+    std::int32_t valueDay = toDays(trade.getValueDate());
+    StringId tradeId = strings_.intern(trade.getTradeIdView());
+    StringId counterparty = strings_.intern(trade.getCounterparty());
+
+    notionals_.push_back(trade.getNotional());
+    rates_.push_back(trade.getRate());
+    tradeDays_.push_back(tradeDay);
+    valueDays_.push_back(valueDay);
+    tradeIds_.push_back(tradeId);
+    tradeTypes_.push_back(trade.getTradeTypeSymbol());
+    instruments_.push_back(trade.getInstrumentSymbol());
+    counterparties_.push_back(counterparty);
+    kinds_.push_back(fx ? Kind::Fx : Kind::Bond);
+    return kinds_.size() - 1;
+}
+
+std::vector<ITrade*> TradeBook::trades() {
+    for (std::size_t row = adapters_.size(); row < size(); ++row) {
+        adapters_.emplace_back(this, row);
+    }
+
+    std::vector<ITrade*> result;
+    result.reserve(adapters_.size());
+    for (auto& adapter : adapters_) {
+        result.push_back(&adapter);
+    }
+    return result;
+}
@@ -0,0 +1,119 @@
+#ifndef TRADEBOOK_H
+#define TRADEBOOK_H
+
+#include "ITrade.h"
+#include "StringPool.h"
+#include "Symbol.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string_view>
+#include <vector>
+
+class TradeBookTrade;
+
+/*
+ * TradeBook
+ *
+ * Holds trades in struct-of-arrays form: one contiguous column per field,
+ * dates packed as int32 days since 1970-01-01 (UTC) and strings stored as
+ * 32-bit ids. Trade types and instruments are process-wide Symbols. Trade
+ * ids and counterparties are open-ended, so they go into a StringPool owned
+ * by the book and are released with it rather than filling the
+ * never-freed SymbolTable.
+ *
+ * Pricers and aggregations can sweep a single column (e.g. notionals())
+ * without touching the rest of the row. Code that still wants ITrade* can
+ * call trades(), which returns thin adapters owned by the book.
+ *
+ * Adapters point back at the book, so a TradeBook is neither copyable nor
+ * movable.
+ */
+class TradeBook {
+public:
+    using StringId = StringPool::Id;
+
+    enum class Kind : std::uint8_t { Bond = 0, Fx = 1 };
+
+    /*
+     * View
+     *
+     * Read-only handle on one row. Two words wide; cheap to pass by value.
+     */
+    class View {
+    public:
+        View(const TradeBook* book, std::size_t row) : book_(book), row_(row) {}
+
+        std::size_t row() const { return row_; }
+        Kind kind() const { return book_->kinds_[row_]; }
+        std::string_view tradeId() const { return book_->str(book_->tradeIds_[row_]); }
+        Symbol tradeType() const { return book_->tradeTypes_[row_]; }
+        Symbol instrument() const { return book_->instruments_[row_]; }
+        std::string_view counterparty() const { return book_->str(book_->counterparties_[row_]); }
+        double notional() const { return book_->notionals_[row_]; }
+        double rate() const { return book_->rates_[row_]; }
+        std::int32_t tradeDay() const { return book_->tradeDays_[row_]; }
+        std::int32_t valueDay() const { return book_->valueDays_[row_]; }
+        std::chrono::system_clock::time_point tradeDate() const { return fromDays(tradeDay()); }
+        std::chrono::system_clock::time_point valueDate() const { return fromDays(valueDay()); }
+
+    private:
+        const TradeBook* book_;
+        std::size_t row_;
+    };
+
+    TradeBook() = default;
+    ~TradeBook();
+    TradeBook(const TradeBook&) = delete;
+    TradeBook& operator=(const TradeBook&) = delete;
+
+    // Copies the fields of trade into a new row and returns its index.
+    // The kind follows the trade type; trades without a value date (see
+    // ITrade::getValueDate) get a zero value day.
+    std::size_t add(const ITrade& trade);
+    void reserve(std::size_t rows);
+
+    std::size_t size() const { return kinds_.size(); }
+    bool empty() const { return kinds_.empty(); }
+    View operator[](std::size_t row) const { return View(this, row); }
+
+    std::string_view str(StringId id) const { return strings_.view(id); }
+
+    // Column access for cache-friendly sweeps.
+    const std::vector<double>& notionals() const { return notionals_; }
+    const std::vector<double>& rates() const { return rates_; }
+    const std::vector<std::int32_t>& tradeDays() const { return tradeDays_; }
+    const std::vector<std::int32_t>& valueDays() const { return valueDays_; }
+    const std::vector<StringId>& tradeIds() const { return tradeIds_; }
+    const std::vector<Symbol>& tradeTypes() const { return tradeTypes_; }
+    const std::vector<Symbol>& instruments() const { return instruments_; }
+    const std::vector<StringId>& counterparties() const { return counterparties_; }
+    const std::vector<Kind>& kinds() const { return kinds_; }
+
+    // One ITrade adapter per row, created on first request and owned by the
+    // book. Setters on an adapter write through to the columns.
+    std::vector<ITrade*> trades();
+
+    // Dates are truncated to whole UTC days.
+    static std::int32_t toDays(const std::chrono::system_clock::time_point& date);
+    static std::chrono::system_clock::time_point fromDays(std::int32_t days);
+
+private:
+    friend class TradeBookTrade;
+
+    StringPool strings_;
+    std::vector<double> notionals_;
+    std::vector<double> rates_;
+    std::vector<std::int32_t> tradeDays_;
+    std::vector<std::int32_t> valueDays_;
+    std::vector<StringId> tradeIds_;
+    std::vector<Symbol> tradeTypes_;
+    std::vector<Symbol> instruments_;
+    std::vector<StringId> counterparties_;
+    std::vector<Kind> kinds_;
+
+    // deque keeps adapter addresses stable as rows are added.
+    std::deque<TradeBookTrade> adapters_;
+};
+
+#endif // TRADEBOOK_H
@@ -0,0 +1,57 @@
+#ifndef TRADEBOOKTRADE_H
+#define TRADEBOOKTRADE_H
+
+#include "ITrade.h"
+#include "TradeBook.h"
+#include <chrono>
+#include <string>
+
+/*
+ * TradeBookTrade
+ *
+ * ITrade adapter over one TradeBook row, so the existing pricers can price
+ * book-resident trades unchanged. Getters copy out of the columns; setters
+ * write back into them (dates are truncated to whole days).
+ */
+class TradeBookTrade : public ITrade {
+public:
+    TradeBookTrade(TradeBook* book, std::size_t row) : book_(book), row_(row) {}
+
+    std::chrono::system_clock::time_point getTradeDate() const override {
+        return TradeBook::fromDays(book_->tradeDays_[row_]);
+    }
+    void setTradeDate(const std::chrono::system_clock::time_point& date) override {
+        book_->tradeDays_[row_] = TradeBook::toDays(date);
+    }
+
+    std::string getInstrument() const override { return book_->instruments_[row_].str(); }
+    void setInstrument(const std::string& instrument) override { book_->instruments_[row_] = Symbol(instrument); }
+
+    std::string getCounterparty() const override { return std::string(book_->str(book_->counterparties_[row_])); }
+    void setCounterparty(const std::string& counterparty) override { book_->counterparties_[row_] = book_->strings_.intern(counterparty); }
+
+    double getNotional() const override { return book_->notionals_[row_]; }
+    void setNotional(double notional) override { book_->notionals_[row_] = notional; }
+
+    double getRate() const override { return book_->rates_[row_]; }
+    void setRate(double rate) override { book_->rates_[row_] = rate; }
+
+    std::string getTradeType() const override { return book_->tradeTypes_[row_].str(); }
+    std::string getTradeId() const override { return std::string(book_->str(book_->tradeIds_[row_])); }
+
+    Symbol getTradeTypeSymbol() const override { return book_->tradeTypes_[row_]; }
+    Symbol getInstrumentSymbol() const override { return book_->instruments_[row_]; }
+    std::string_view getTradeIdView() const override { return book_->str(book_->tradeIds_[row_]); }
+
+    std::chrono::system_clock::time_point getValueDate() const override {
+        return TradeBook::fromDays(book_->valueDays_[row_]);
+    }
+
+    std::size_t getRow() const { return row_; }
+
+private:
+    TradeBook* book_;
+    std::size_t row_;
+};
+
+#endif // TRADEBOOKTRADE_H
@@ -0,0 +1,81 @@
+#ifndef TRADEHASHER_H
+#define TRADEHASHER_H
+
+#include "ITrade.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/*
+ * TradeHasher
+ *
+ * Stable 64-bit hash of the fields that determine a trade's price: type,
+ * id, instrument, notional, rate, trade date and (for FX) value date.
+ * Counterparty is left out. The salt lets callers separate key spaces,
+ * e.g. by engine version.
+ *
+ * The value depends only on the field contents, never on addresses or the
+ * platform's clock period, so it can be persisted and compared across runs.
+ */
+class TradeHasher {
+public:
+    static std::uint64_t hashOf(const ITrade& trade, std::string_view salt = std::string_view()) {
+        TradeHasher hasher;
+        hasher.add(salt);
+        hasher.add(trade.getTradeTypeSymbol().view());
+        hasher.add(trade.getTradeIdView());
+        hasher.add(trade.getInstrumentSymbol().view());
+        hasher.add(trade.getNotional());
+        hasher.add(trade.getRate());
+        hasher.add(trade.getTradeDate());
+        hasher.add(trade.getValueDate());
+        return hasher.hash();
+    }
+
+    void add(std::string_view value) {
+        bytes(value.data(), value.size());
+        // Separator so ("ab", "c") and ("a", "bc") differ.
+        unsigned char end = 0xFF;
+        bytes(&end, 1);
+    }
+
+    void add(double value) {
+        if (value == 0.0) {
+            value = 0.0;    // -0.0 and 0.0 price the same
+        }
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bytes(&bits, sizeof(bits));
+    }
+
+    // Microseconds since the epoch, independent of the platform's clock period.
+    void add(std::chrono::system_clock::time_point value) {
+        std::int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(value.time_since_epoch()).count();
+        bytes(&micros, sizeof(micros));
+    }
+
+    std::uint64_t hash() const {
+        // Final avalanche so every bit of the key depends on every input byte.
+        std::uint64_t h = hash_;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+private:
+    void bytes(const void* data, std::size_t size) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash_ ^= p[i];
+            hash_ *= 1099511628211ULL;
+        }
+    }
+
+    std::uint64_t hash_ = 14695981039346656037ULL;
+};
+
+#endif // TRADEHASHER_H
@@ -0,0 +1,48 @@
+#ifndef VIRTUALCLOCK_H
+#define VIRTUALCLOCK_H
+
+#include "IClock.h"
+#include <atomic>
+
+/*
+ * VirtualClock
+ *
+ * Discrete-event time: sleepFor returns immediately and moves the clock
+ * forward by the requested duration instead of blocking, so an engine
+ * "takes" its configured latency at no wall-clock cost. Time starts at the
+ * clock's epoch and only moves when someone sleeps or advances it.
+ *
+ * The clock is a single timeline: concurrent sleepers are charged one after
+ * another, which is exact for serial runs. PricingSimulator models the
+ * parallel pricers on top of the same latencies. Cancellation tokens still
+ * fire in wall-clock time.
+ */
+class VirtualClock : public IClock {
+public:
+    Clock::time_point now() const override {
+        return Clock::time_point(Clock::duration(ticks_.load(std::memory_order_acquire)));
+    }
+
+    bool sleepFor(Clock::duration duration, const CancellationToken& token) override {
+        if (token.isCancelled()) {
+            return false;
+        }
+        advance(duration);
+        return true;
+    }
+
+    void advance(Clock::duration duration) {
+        if (duration.count() > 0) {
+            ticks_.fetch_add(duration.count(), std::memory_order_acq_rel);
+        }
+    }
+
+    Clock::duration elapsed() const {
+        return now().time_since_epoch();
+    }
+
+private:
+    std::atomic<Clock::rep> ticks_ { 0 };
+};
+
+#endif // VIRTUALCLOCK_H
@@ -1,12 +1,24 @@
 #include "BasePricingEngine.h"
+#include "Philox.h"
+#include "../Models/SystemClock.h"
 #include <random>
-#include <thread>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
-#include <limits>
+#include <vector>
 
-BasePricingEngine::BasePricingEngine() : delay_(5000) {
+namespace {
+    std::uint64_t randomSeed() {
+        std::random_device rd;
+        return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+    }
+
+    const char* const NoValueError = "Pricing model could not produce a value for this trade";
+}
+
+BasePricingEngine::BasePricingEngine()
+    : fixedLatency_(5000), perTradeLatency_(0), seed_(randomSeed()), clock_(&SystemClock::instance()) {
 }
 
 void BasePricingEngine::price(ITrade* trade, IScalarResultReceiver* resultReceiver) {
@@ -22,23 +34,171 @@ void BasePricingEngine::price(ITrade* trade, IScalarResultReceiver* resultReceiv
 }
 
 bool BasePricingEngine::isTradeTypeSupported(const std::string& tradeType) const {
+    return isTradeTypeSupported(Symbol(tradeType));
+}
+
+bool BasePricingEngine::isTradeTypeSupported(Symbol tradeType) const {
     return supportedTypes_.find(tradeType) != supportedTypes_.end();
 }
 
 void BasePricingEngine::addSupportedTradeType(const std::string& tradeType) {
-    supportedTypes_[tradeType] = 0;
+    supportedTypes_.insert(Symbol(tradeType));
 }
 
 int BasePricingEngine::getDelay() const {
-    return delay_;
+    return static_cast<int>(latencyFor(1).count());
 }
 
 void BasePricingEngine::setDelay(int delay) {
-    delay_ = delay;
+    setLatency(std::chrono::milliseconds(delay), std::chrono::milliseconds(0));
+}
+
+std::chrono::milliseconds BasePricingEngine::getFixedLatency() const {
+    return fixedLatency_;
+}
+
+std::chrono::milliseconds BasePricingEngine::getPerTradeLatency() const {
+    return perTradeLatency_;
+}
+
+void BasePricingEngine::setLatency(std::chrono::milliseconds fixed, std::chrono::milliseconds perTrade) {
+    if (fixed.count() < 0 || perTrade.count() < 0) {
+        throw std::invalid_argument("Latency cannot be negative");
+    }
+    fixedLatency_ = fixed;
+    perTradeLatency_ = perTrade;
+}
+
+std::chrono::milliseconds BasePricingEngine::latencyFor(std::size_t tradeCount) const {
+    return fixedLatency_ + perTradeLatency_ * static_cast<std::chrono::milliseconds::rep>(tradeCount);
+}
+
+std::uint64_t BasePricingEngine::getSeed() const {
+    return seed_;
+}
+
+void BasePricingEngine::setSeed(std::uint64_t seed) {
+    seed_ = seed;
+}
+
+std::string BasePricingEngine::getCacheTag() const {
+    return "philox/v" + std::to_string(ModelVersion) + ";seed=" + std::to_string(seed_);
+}
+
+IClock& BasePricingEngine::getClock() const {
+    return *clock_;
+}
+
+void BasePricingEngine::setClock(IClock& clock) {
+    clock_ = &clock;
+}
+
+void BasePricingEngine::priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) {
+    priceBatch(trades, resultReceiver, CancellationToken());
+}
+
+/*
+ * priceBatch
+ *
+ * Unsupported trades are rejected up front; the rest share a single
+ * simulated round trip to the backend. Results are delivered to the
+ * receiver in one addResults call.
+ *
+ * The round trip is abandoned as soon as the token fires; the supported
+ * trades are then reported as timed out. A token that has already fired
+ * skips the backend call altogether.
+ */
+void BasePricingEngine::priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver,
+                                   const CancellationToken& token) {
+    if (resultReceiver == nullptr) {
+        throw std::invalid_argument("resultReceiver_");
+    }
+
+    for (ITrade* trade : trades) {
+        if (trade == nullptr) {
+            throw std::invalid_argument("trade_");
+        }
+        if (trade->getTradeIdView().empty()) {
+            throw std::invalid_argument("Trade does not have a valid ID");
+        }
+    }
+
+    std::vector<ResultRecord> records;
+    records.reserve(trades.size());
+
+    std::size_t supported = 0;
+    for (ITrade* trade : trades) {
+        if (isTradeTypeSupported(trade->getTradeTypeSymbol())) {
+            ++supported;
+        }
+    }
+
+    bool timedOut = token.isCancelled();
+    if (supported > 0 && !timedOut) {
+        std::cout << "Started pricing batch of " << supported << " trades" << std::endl;
+        timedOut = !clock_->sleepFor(latencyFor(supported), token);
+    }
+
+    // Values for all supported trades in one call, so engines can compute
+    // the batch together.
+    std::vector<ITrade*> priceable;
+    std::vector<double> values;
+    if (!timedOut) {
+        priceable.reserve(supported);
+        for (ITrade* trade : trades) {
+            if (isTradeTypeSupported(trade->getTradeTypeSymbol())) {
+                priceable.push_back(trade);
+            }
+        }
+        values.resize(priceable.size());
+        calculateResults(priceable, values);
+    }
+
+    const auto& tradesToError = getTradesToError();
+    const auto& tradesToWarn = getTradesToWarn();
+
+    std::size_t next = 0;
+    for (ITrade* trade : trades) {
+        std::string_view tradeId = trade->getTradeIdView();
+        if (!isTradeTypeSupported(trade->getTradeTypeSymbol())) {
+            records.push_back(ResultRecord { tradeId, 0.0, ResultCode::UnsupportedTradeType, "" });
+            continue;
+        }
+        if (timedOut) {
+            records.push_back(ResultRecord { tradeId, 0.0, ResultCode::Timeout, "" });
+            continue;
+        }
+
+        double result = values[next++];
+        auto error = tradesToError.find(tradeId);
+        if (error != tradesToError.end()) {
+            records.push_back(ResultRecord { tradeId, 0.0, ResultCode::Error, error->second });
+            continue;
+        }
+        if (!std::isfinite(result)) {
+            records.push_back(ResultRecord { tradeId, 0.0, ResultCode::Error, NoValueError });
+            continue;
+        }
+
+        auto warning = tradesToWarn.find(tradeId);
+        if (warning != tradesToWarn.end()) {
+            records.push_back(ResultRecord { tradeId, result, ResultCode::Warning, warning->second });
+        } else {
+            records.push_back(ResultRecord { tradeId, result, ResultCode::Ok, "" });
+        }
+    }
+
+    resultReceiver->addResults(records);
+
+    if (supported > 0 && timedOut) {
+        std::cout << "Timed out pricing batch of " << supported << " trades" << std::endl;
+    } else if (supported > 0) {
+        std::cout << "Completed pricing batch of " << supported << " trades" << std::endl;
+    }
 }
 
 void BasePricingEngine::priceTrade(ITrade* trade, IScalarResultReceiver* resultReceiver) {
-    if (!isTradeTypeSupported(trade->getTradeType())) {
+    if (!isTradeTypeSupported(trade->getTradeTypeSymbol())) {
         if (trade->getTradeId().empty()) {
             throw std::invalid_argument("Trade does not have a valid ID");
         }
@@ -48,53 +208,52 @@ void BasePricingEngine::priceTrade(ITrade* trade, IScalarResultReceiver* resultR
     }
     
     std::cout << "Started pricing trade: " << trade->getTradeId() << std::endl;
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay_));
-    double result = calculateResult();
+    clock_->sleepFor(latencyFor(1), CancellationToken());
+    double result = calculateResult(*trade);
     
     std::string tradeId = trade->getTradeId();
-    auto& tradesToError = getTradesToError();
-    auto& tradesToWarn = getTradesToWarn();
+    const auto& tradesToError = getTradesToError();
+    const auto& tradesToWarn = getTradesToWarn();
     
-    if (tradesToError.find(tradeId) != tradesToError.end()) {
-        resultReceiver->addError(tradeId, tradesToError[tradeId]);
+    auto error = tradesToError.find(tradeId);
+    if (error != tradesToError.end()) {
+        resultReceiver->addError(tradeId, error->second);
+    } else if (!std::isfinite(result)) {
+        resultReceiver->addError(tradeId, NoValueError);
     } else {
         resultReceiver->addResult(tradeId, result);
-        if (tradesToWarn.find(tradeId) != tradesToWarn.end()) {
-            resultReceiver->addError(tradeId, tradesToWarn[tradeId]);
+        auto warning = tradesToWarn.find(tradeId);
+        if (warning != tradesToWarn.end()) {
+            resultReceiver->addError(tradeId, warning->second);
         }
     }
     
     std::cout << "Completed pricing trade: " << trade->getTradeId() << std::endl;
 }
 
-double BasePricingEngine::calculateResult() {
-    return random_.nextDouble() * 100.0;
-}
-
-BasePricingEngine::Random::Random() : gen_(rd_()), dist_(0, std::numeric_limits<unsigned int>::max()) {
+double BasePricingEngine::calculateResult(const ITrade& trade) const {
+    return Philox4x32::uniform(seed_, Philox4x32::idOf(trade.getTradeIdView())) * 100.0;
 }
 
-double BasePricingEngine::Random::nextDouble() {
-    return static_cast<double>(dist_(gen_)) / static_cast<double>(std::numeric_limits<unsigned int>::max());
+void BasePricingEngine::calculateResults(std::span<ITrade* const> trades, std::span<double> results) const {
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        results[i] = calculateResult(*trades[i]);
+    }
 }
 
-std::map<std::string, std::string>& BasePricingEngine::getTradesToError() {
-    static std::map<std::string, std::string> tradesToError;
-    static bool initialized = false;
-    if (!initialized) {
-        tradesToError["GOV006"] = "Undefined error in pricing";
-        initialized = true;
-    }
+// Function-local statics are initialised exactly once, even under concurrent
+// first use, and are never written afterwards.
+const std::map<std::string, std::string, std::less<>>& BasePricingEngine::getTradesToError() {
+    static const std::map<std::string, std::string, std::less<>> tradesToError {
+        { "GOV006", "Undefined error in pricing" }
+    };
     return tradesToError;
 }
 
-std::map<std::string, std::string>& BasePricingEngine::getTradesToWarn() {
-    static std::map<std::string, std::string> tradesToWarn;
-    static bool initialized = false;
-    if (!initialized) {
-        tradesToWarn["FWD001"] = "Unable to calibrate model to value date";
-        initialized = true;
-    }
+const std::map<std::string, std::string, std::less<>>& BasePricingEngine::getTradesToWarn() {
+    static const std::map<std::string, std::string, std::less<>> tradesToWarn {
+        { "FWD001", "Unable to calibrate model to value date" }
+    };
     return tradesToWarn;
 }
 
@@ -4,45 +4,89 @@
 #include "../Models/IPricingEngine.h"
 #include "../Models/ITrade.h"
 #include "../Models/IScalarResultReceiver.h"
+#include "../Models/Symbol.h"
+#include "../Models/IClock.h"
+#include <chrono>
+#include <cstdint>
 #include <map>
+#include <span>
 #include <string>
-#include <random>
+#include <unordered_set>
 
+/*
+ * BasePricingEngine
+ *
+ * Configuration (supported types, latency, seed) is set up before pricing
+ * starts; after that price() and priceBatch() only read shared state, so a
+ * single instance can be called from any number of threads at once.
+ *
+ * Results are drawn from a counter-based generator keyed by the seed and
+ * the trade id rather than from a shared sequential stream, so a trade's
+ * value depends only on (seed, trade id) - not on the thread that prices
+ * it, the batch it is in, or how many threads the run uses. Engines with
+ * a real model override calculateResult/calculateResults instead (see
+ * BondPricingEngine).
+ */
 class BasePricingEngine : public IPricingEngine {
 protected:
     BasePricingEngine();
     virtual ~BasePricingEngine() = default;
     
     void price(ITrade* trade, IScalarResultReceiver* resultReceiver) override;
+    void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) override;
+    void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver,
+                    const CancellationToken& token) override;
     
 public:
     bool isTradeTypeSupported(const std::string& tradeType) const;
+    bool isTradeTypeSupported(Symbol tradeType) const;
+
+    /*
+     * Simulated backend latency: every call pays a fixed setup cost plus a
+     * cost per priced trade, so a batch of n trades waits fixed + n * perTrade
+     * once rather than n * (fixed + perTrade).
+     */
+    std::chrono::milliseconds getFixedLatency() const;
+    std::chrono::milliseconds getPerTradeLatency() const;
+    void setLatency(std::chrono::milliseconds fixed, std::chrono::milliseconds perTrade);
+    std::chrono::milliseconds latencyFor(std::size_t tradeCount) const;
+
+    // Clock used for the simulated latency; defaults to SystemClock. A
+    // VirtualClock makes the engine charge its latency without sleeping.
+    // The clock is not owned and must outlive the engine's use of it.
+    IClock& getClock() const;
+    void setClock(IClock& clock);
+
+    // Defaults to a fresh random seed per engine instance.
+    std::uint64_t getSeed() const;
+    void setSeed(std::uint64_t seed);
+
+    // Version of the seeded result and the seed itself.
+    std::string getCacheTag() const override;
     
 protected:
     void addSupportedTradeType(const std::string& tradeType);
+    // Single-trade latency in ms. setDelay makes the whole delay a fixed cost.
     int getDelay() const;
     void setDelay(int delay);
     virtual void priceTrade(ITrade* trade, IScalarResultReceiver* resultReceiver);
-    virtual double calculateResult();
+    virtual double calculateResult(const ITrade& trade) const;
+    // Batch form used by priceBatch; the default calls calculateResult per
+    // trade. A non-finite value is reported as an error for that trade.
+    virtual void calculateResults(std::span<ITrade* const> trades, std::span<double> results) const;
     
 private:
-    std::map<std::string, unsigned int> supportedTypes_;
-    int delay_;
-    
-    class Random {
-    public:
-        Random();
-        double nextDouble();
-    private:
-        std::random_device rd_;
-        std::mt19937 gen_;
-        std::uniform_int_distribution<unsigned int> dist_;
-    };
-    
-    Random random_;
+    // Bump whenever a change alters the results calculateResult produces.
+    static constexpr int ModelVersion = 1;
+
+    std::unordered_set<Symbol> supportedTypes_;
+    std::chrono::milliseconds fixedLatency_;
+    std::chrono::milliseconds perTradeLatency_;
+    std::uint64_t seed_;
+    IClock* clock_;
     
-    static std::map<std::string, std::string>& getTradesToError();
-    static std::map<std::string, std::string>& getTradesToWarn();
+    static const std::map<std::string, std::string, std::less<>>& getTradesToError();
+    static const std::map<std::string, std::string, std::less<>>& getTradesToWarn();
 };
 
 #endif // BASEPRICINGENGINE_H
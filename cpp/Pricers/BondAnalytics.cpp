@@ -0,0 +1,277 @@
+#include "BondAnalytics.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+    /*
+     * For yield y and v = 1 / (1 + y/f), each kernel evaluates
+     *   P(y)  = sum cf_k v^k
+     *   P'(y) = -(v/f) sum k cf_k v^k
+     * in one pass over the cash flows and steps y -= (P - target) / P'
+     * until |P - target| < Tolerance. y never drops below floor, which
+     * keeps 1 + y/f positive.
+     */
+    struct Problem {
+        const double* cashFlows;
+        const double* weightedCashFlows;   // k * cf_k
+        std::size_t periods;
+        double frequency;
+        double floor;
+    };
+
+    /*
+     * Scalar kernel
+     * Used on non-x86 targets, for single trades and for the tails
+     * shorter than one vector.
+     */
+    void newtonScalar(const Problem& problem, const double* target, double* y, double* price, double* slope,
+                      std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            double yi = y[i];
+            double p = 0.0;
+            double s = 0.0;
+            auto evaluate = [&]() {
+                double v = 1.0 / (1.0 + yi / problem.frequency);
+                double discount = 1.0;
+                double weighted = 0.0;
+                p = 0.0;
+                for (std::size_t k = 0; k < problem.periods; ++k) {
+                    discount = discount * v;
+                    p = p + problem.cashFlows[k] * discount;
+                    weighted = weighted + problem.weightedCashFlows[k] * discount;
+                }
+                s = (0.0 - v * weighted) / problem.frequency;
+            };
+
+            bool done = false;
+            for (int iteration = 0; iteration < BondAnalytics::MaxIterations; ++iteration) {
+                evaluate();
+                double error = p - target[i];
+                if (std::abs(error) < BondAnalytics::Tolerance) {
+                    done = true;
+                    break;
+                }
+                double next = yi - error / s;
+                yi = next > problem.floor ? next : problem.floor;
+            }
+            if (!done) {
+                evaluate();
+            }
+            y[i] = yi;
+            price[i] = p;
+            slope[i] = s;
+        }
+    }
+
+#ifdef CPUISA_SSE2
+    void evaluateSse2(const Problem& problem, __m128d y, __m128d& price, __m128d& slope) {
+        const __m128d one = _mm_set1_pd(1.0);
+        const __m128d zero = _mm_setzero_pd();
+        const __m128d frequency = _mm_set1_pd(problem.frequency);
+        __m128d v = _mm_div_pd(one, _mm_add_pd(one, _mm_div_pd(y, frequency)));
+        __m128d discount = one;
+        __m128d weighted = zero;
+        price = zero;
+        for (std::size_t k = 0; k < problem.periods; ++k) {
+            discount = _mm_mul_pd(discount, v);
+            price = _mm_add_pd(price, _mm_mul_pd(_mm_set1_pd(problem.cashFlows[k]), discount));
+            weighted = _mm_add_pd(weighted, _mm_mul_pd(_mm_set1_pd(problem.weightedCashFlows[k]), discount));
+        }
+        slope = _mm_div_pd(_mm_sub_pd(zero, _mm_mul_pd(v, weighted)), frequency);
+    }
+
+    void newtonSse2(const Problem& problem, const double* target, double* y, double* price, double* slope,
+                    std::size_t count) {
+        const __m128d zero = _mm_setzero_pd();
+        const __m128d floor = _mm_set1_pd(problem.floor);
+        const __m128d tolerance = _mm_set1_pd(BondAnalytics::Tolerance);
+        const __m128d signBit = _mm_set1_pd(-0.0);
+
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            const __m128d goal = _mm_loadu_pd(target + i);
+            __m128d yv = _mm_loadu_pd(y + i);
+            __m128d p = zero;
+            __m128d s = zero;
+            __m128d done = zero;
+            bool allDone = false;
+            for (int iteration = 0; iteration < BondAnalytics::MaxIterations; ++iteration) {
+                evaluateSse2(problem, yv, p, s);
+                __m128d error = _mm_sub_pd(p, goal);
+                done = _mm_or_pd(done, _mm_cmplt_pd(_mm_andnot_pd(signBit, error), tolerance));
+                if (_mm_movemask_pd(done) == 0x3) {
+                    allDone = true;
+                    break;
+                }
+                __m128d next = _mm_max_pd(_mm_sub_pd(yv, _mm_div_pd(error, s)), floor);
+                yv = _mm_or_pd(_mm_and_pd(done, yv), _mm_andnot_pd(done, next));
+            }
+            if (!allDone) {
+                evaluateSse2(problem, yv, p, s);
+            }
+            _mm_storeu_pd(y + i, yv);
+            _mm_storeu_pd(price + i, p);
+            _mm_storeu_pd(slope + i, s);
+        }
+        newtonScalar(problem, target + i, y + i, price + i, slope + i, count - i);
+    }
+#endif
+
+#ifdef CPUISA_AVX2
+    CPUISA_TARGET_AVX2
+    void evaluateAvx2(const Problem& problem, __m256d y, __m256d& price, __m256d& slope) {
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d frequency = _mm256_set1_pd(problem.frequency);
+        __m256d v = _mm256_div_pd(one, _mm256_add_pd(one, _mm256_div_pd(y, frequency)));
+        __m256d discount = one;
+        __m256d weighted = zero;
+        price = zero;
+        for (std::size_t k = 0; k < problem.periods; ++k) {
+            discount = _mm256_mul_pd(discount, v);
+            price = _mm256_add_pd(price, _mm256_mul_pd(_mm256_set1_pd(problem.cashFlows[k]), discount));
+            weighted = _mm256_add_pd(weighted, _mm256_mul_pd(_mm256_set1_pd(problem.weightedCashFlows[k]), discount));
+        }
+        slope = _mm256_div_pd(_mm256_sub_pd(zero, _mm256_mul_pd(v, weighted)), frequency);
+    }
+
+    CPUISA_TARGET_AVX2
+    void newtonAvx2(const Problem& problem, const double* target, double* y, double* price, double* slope,
+                    std::size_t count) {
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d floor = _mm256_set1_pd(problem.floor);
+        const __m256d tolerance = _mm256_set1_pd(BondAnalytics::Tolerance);
+        const __m256d signBit = _mm256_set1_pd(-0.0);
+
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m256d goal = _mm256_loadu_pd(target + i);
+            __m256d yv = _mm256_loadu_pd(y + i);
+            __m256d p = zero;
+            __m256d s = zero;
+            __m256d done = zero;
+            bool allDone = false;
+            for (int iteration = 0; iteration < BondAnalytics::MaxIterations; ++iteration) {
+                evaluateAvx2(problem, yv, p, s);
+                __m256d error = _mm256_sub_pd(p, goal);
+                done = _mm256_or_pd(done, _mm256_cmp_pd(_mm256_andnot_pd(signBit, error), tolerance, _CMP_LT_OQ));
+                if (_mm256_movemask_pd(done) == 0xF) {
+                    allDone = true;
+                    break;
+                }
+                __m256d next = _mm256_max_pd(_mm256_sub_pd(yv, _mm256_div_pd(error, s)), floor);
+                yv = _mm256_blendv_pd(next, yv, done);
+            }
+            if (!allDone) {
+                evaluateAvx2(problem, yv, p, s);
+            }
+            _mm256_storeu_pd(y + i, yv);
+            _mm256_storeu_pd(price + i, p);
+            _mm256_storeu_pd(slope + i, s);
+        }
+        newtonSse2(problem, target + i, y + i, price + i, slope + i, count - i);
+    }
+#endif
+
+    void newton(BondAnalytics::Isa isa, const Problem& problem, const double* target, double* y, double* price,
+                double* slope, std::size_t count) {
+        switch (isa) {
+#ifdef CPUISA_AVX2
+        case BondAnalytics::Isa::Avx2: newtonAvx2(problem, target, y, price, slope, count); return;
+#endif
+#ifdef CPUISA_SSE2
+        case BondAnalytics::Isa::Sse2: newtonSse2(problem, target, y, price, slope, count); return;
+#endif
+        default: newtonScalar(problem, target, y, price, slope, count); return;
+        }
+    }
+}
+
+BondAnalytics::BondAnalytics(const Terms& terms)
+    : BondAnalytics(terms, detectIsa()) {
+}
+
+BondAnalytics::BondAnalytics(const Terms& terms, Isa isa)
+    : terms_(terms), isa_(isa) {
+    if (terms.years <= 0 || terms.frequency <= 0 || terms.couponRate < 0.0) {
+        throw std::invalid_argument("Bond terms need positive years and frequency and a non-negative coupon");
+    }
+
+    std::size_t periods = static_cast<std::size_t>(terms.years) * static_cast<std::size_t>(terms.frequency);
+    cashFlows_.assign(periods, terms.couponRate / terms.frequency);
+    cashFlows_.back() += 100.0;
+
+    // Never run an instruction set the CPU does not have.
+    isa_ = CpuIsa::supported(isa_);
+}
+
+double BondAnalytics::priceFromYield(double yield) const {
+    double v = 1.0 / (1.0 + yield / terms_.frequency);
+    double discount = 1.0;
+    double price = 0.0;
+    for (double cashFlow : cashFlows_) {
+        discount = discount * v;
+        price = price + cashFlow * discount;
+    }
+    return price;
+}
+
+void BondAnalytics::solve(std::span<const double> cleanPrices, std::span<const double> notionals,
+                          std::span<Result> results) const {
+    solve(cleanPrices, notionals, results, isa_);
+}
+
+BondAnalytics::Result BondAnalytics::solve(double cleanPrice, double notional) const {
+    Result result;
+    solve(std::span<const double>(&cleanPrice, 1), std::span<const double>(&notional, 1),
+          std::span<Result>(&result, 1), Isa::Scalar);
+    return result;
+}
+
+/*
+ * Prices that are not positive numbers are solved as par bonds to keep the
+ * vectors full, then reported as not converged.
+ */
+void BondAnalytics::solve(std::span<const double> cleanPrices, std::span<const double> notionals,
+                          std::span<Result> results, Isa isa) const {
+    if (cleanPrices.size() != notionals.size() || cleanPrices.size() != results.size()) {
+        throw std::invalid_argument("cleanPrices, notionals and results must be the same length");
+    }
+
+    const std::size_t count = cleanPrices.size();
+    const double floor = -0.9 * terms_.frequency;
+    std::vector<double> weightedCashFlows(cashFlows_.size());
+    for (std::size_t k = 0; k < cashFlows_.size(); ++k) {
+        weightedCashFlows[k] = static_cast<double>(k + 1) * cashFlows_[k];
+    }
+    Problem problem { cashFlows_.data(), weightedCashFlows.data(), cashFlows_.size(),
+                      static_cast<double>(terms_.frequency), floor };
+
+    std::vector<double> target(count);
+    std::vector<double> y(count);
+    std::vector<double> price(count);
+    std::vector<double> slope(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double p = cleanPrices[i];
+        target[i] = std::isfinite(p) && p > 0.0 ? p : 100.0;
+        // Approximate yield to maturity as the starting point.
+        double guess = (terms_.couponRate + (100.0 - target[i]) / terms_.years) / ((100.0 + target[i]) / 2.0);
+        y[i] = guess > floor ? guess : floor;
+    }
+
+    newton(isa, problem, target.data(), y.data(), price.data(), slope.data(), count);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t i = 0; i < count; ++i) {
+        bool valid = std::isfinite(cleanPrices[i]) && cleanPrices[i] > 0.0;
+        bool converged = valid && std::abs(price[i] - target[i]) < Tolerance;
+        Result& result = results[i];
+        result.converged = converged;
+        result.cleanPrice = valid ? cleanPrices[i] : nan;
+        result.yield = converged ? y[i] : nan;
+        result.modifiedDuration = converged ? -slope[i] / price[i] : nan;
+        result.dv01 = converged ? -slope[i] * 1e-4 * notionals[i] / 100.0 : nan;
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef BONDANALYTICS_H
+#define BONDANALYTICS_H
+
+#include "../Models/CpuIsa.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/*
+ * BondAnalytics
+ *
+ * Fixed-coupon bond maths on a face value of 100: price from yield, and the
+ * inverse - yield to maturity from a clean price - by Newton iteration.
+ * Bonds are assumed to settle on a coupon date, so clean and dirty price
+ * coincide and there is no accrued interest.
+ *
+ * The batch solve() runs the Newton iteration on 2 (SSE2) or 4 (AVX2) bonds
+ * at once, one per vector lane; lanes that have converged are frozen while
+ * the others iterate on. The instruction set is picked at runtime (see
+ * CpuIsa). Every kernel performs the same IEEE operations in the
+ * same order (no FMA), so results are bit-identical whichever one runs.
+ */
+class BondAnalytics {
+public:
+    using Isa = CpuIsa::Isa;
+
+    struct Terms {
+        double couponRate = 0.0;    // annual coupon, percent of face
+        int years = 0;
+        int frequency = 2;          // coupons per year
+    };
+
+    struct Result {
+        double cleanPrice = 0.0;        // per 100 face
+        double yield = 0.0;             // decimal, compounded at the coupon frequency
+        double modifiedDuration = 0.0;  // years
+        double dv01 = 0.0;              // value change of the position for a 1bp fall in yield
+        bool converged = false;         // false for non-positive prices or no convergence
+    };
+
+    static constexpr double Tolerance = 1e-10;     // on price per 100
+    static constexpr int MaxIterations = 50;
+
+    // Uses the best instruction set available on this CPU.
+    explicit BondAnalytics(const Terms& terms);
+    // Forces a specific instruction set, downgraded if the CPU lacks it.
+    BondAnalytics(const Terms& terms, Isa isa);
+
+    const Terms& getTerms() const { return terms_; }
+    Isa isa() const { return isa_; }
+
+    double priceFromYield(double yield) const;
+
+    // cleanPrices, notionals and results must be the same length.
+    void solve(std::span<const double> cleanPrices, std::span<const double> notionals,
+               std::span<Result> results) const;
+    Result solve(double cleanPrice, double notional) const;
+
+    static Isa detectIsa() { return CpuIsa::detect(); }
+    static const char* isaName(Isa isa) { return CpuIsa::name(isa); }
+
+private:
+    void solve(std::span<const double> cleanPrices, std::span<const double> notionals,
+               std::span<Result> results, Isa isa) const;
+
+    Terms terms_;
+    Isa isa_;
+    std::vector<double> cashFlows_;     // per coupon period, redemption included
+};
+
+#endif // BONDANALYTICS_H
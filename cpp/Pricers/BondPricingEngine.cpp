@@ -0,0 +1,50 @@
+#include "BondPricingEngine.h"
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+BondPricingEngine::BondPricingEngine(const BondAnalytics::Terms& terms) : analytics_(terms) {
+}
+
+const BondAnalytics::Terms& BondPricingEngine::getTerms() const {
+    return analytics_.getTerms();
+}
+
+void BondPricingEngine::setTerms(const BondAnalytics::Terms& terms) {
+    analytics_ = BondAnalytics(terms);
+}
+
+BondAnalytics::Result BondPricingEngine::analyse(const ITrade& trade) const {
+    return analytics_.solve(trade.getRate(), trade.getNotional());
+}
+
+std::string BondPricingEngine::getCacheTag() const {
+    const BondAnalytics::Terms& terms = getTerms();
+    std::ostringstream tag;
+    tag << "bond-dv01/v" << ModelVersion << ";terms=" << std::setprecision(17)
+        << terms.couponRate << '/' << terms.years << '/' << terms.frequency;
+    return tag.str();
+}
+
+double BondPricingEngine::calculateResult(const ITrade& trade) const {
+    return analyse(trade).dv01;
+}
+
+void BondPricingEngine::calculateResults(std::span<ITrade* const> trades, std::span<double> results) const {
+    std::vector<double> prices;
+    std::vector<double> notionals;
+    prices.reserve(trades.size());
+    notionals.reserve(trades.size());
+    for (ITrade* trade : trades) {
+        prices.push_back(trade->getRate());
+        notionals.push_back(trade->getNotional());
+    }
+
+    std::vector<BondAnalytics::Result> analysed(trades.size());
+    analytics_.solve(prices, notionals, analysed);
+    for (std::size_t i = 0; i < analysed.size(); ++i) {
+        results[i] = analysed[i].dv01;
+    }
+}
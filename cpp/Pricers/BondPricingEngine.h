@@ -0,0 +1,42 @@
+#ifndef BONDPRICINGENGINE_H
+#define BONDPRICINGENGINE_H
+
+#include "BasePricingEngine.h"
+#include "BondAnalytics.h"
+
+/*
+ * BondPricingEngine
+ *
+ * Common base of the bond engines. A bond trade's rate is its clean price
+ * per 100 face; the trade files carry no coupon or maturity, so each engine
+ * assumes one set of terms for all its trades (setTerms to change them).
+ *
+ * The reported value is the position's DV01 from BondAnalytics. A batch is
+ * solved in one vectorised pass. Results are deterministic: they depend on
+ * the trade and the terms only, never on the seed.
+ */
+class BondPricingEngine : public BasePricingEngine {
+public:
+    const BondAnalytics::Terms& getTerms() const;
+    // Configuration: not to be called while the engine is pricing.
+    void setTerms(const BondAnalytics::Terms& terms);
+
+    BondAnalytics::Result analyse(const ITrade& trade) const;
+
+    // Model version and terms; the seed plays no part.
+    std::string getCacheTag() const override;
+
+protected:
+    explicit BondPricingEngine(const BondAnalytics::Terms& terms);
+
+    double calculateResult(const ITrade& trade) const override;
+    void calculateResults(std::span<ITrade* const> trades, std::span<double> results) const override;
+
+private:
+    // Bump whenever a change alters the values the engine reports.
+    static constexpr int ModelVersion = 1;
+
+    BondAnalytics analytics_;
+};
+
+#endif // BONDPRICINGENGINE_H
@@ -0,0 +1,162 @@
+#include "CachingPricingEngine.h"
+#include "BasePricingEngine.h"
+#include "../Models/ResultBatch.h"
+#include "../Models/TradeHasher.h"
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    /*
+     * Receives the normalized results of the misses (via ResultBatch::flushTo),
+     * stores them under each trade's key and forwards them unchanged.
+     *
+     * Results are matched to trades by position, not by id alone: a batch
+     * may hold two trades with one id but different content, and each result
+     * must be stored under its own trade's key. Engines report in batch
+     * order, so a record is matched to the next trade at or after the last
+     * match with its id; a record that matches none is passed on uncached.
+     */
+    class StoringReceiver : public IScalarResultReceiver {
+    public:
+        StoringReceiver(PricingResultCache& cache, const std::vector<ITrade*>& trades,
+                        const std::vector<std::uint64_t>& keys, IScalarResultReceiver& target)
+            : cache_(cache), trades_(trades), keys_(keys), target_(target) {}
+
+        void addResult(const std::string& tradeId, double result) override {
+            target_.addResult(tradeId, result);
+        }
+
+        void addError(const std::string& tradeId, const std::string& error) override {
+            target_.addError(tradeId, error);
+        }
+
+        void addResults(std::span<const ResultRecord> records) override {
+            for (const ResultRecord& record : records) {
+                std::size_t i = next_;
+                while (i < trades_.size() && trades_[i]->getTradeIdView() != record.tradeId) {
+                    ++i;
+                }
+                if (i == trades_.size()) {
+                    continue;
+                }
+                next_ = i + 1;
+                if (record.code != ResultCode::Timeout) {
+                    cache_.store(keys_[i], PricingResultCache::Entry { record.value, record.code, std::string(record.detail) });
+                }
+            }
+            target_.addResults(records);
+        }
+
+    private:
+        PricingResultCache& cache_;
+        const std::vector<ITrade*>& trades_;
+        const std::vector<std::uint64_t>& keys_;
+        IScalarResultReceiver& target_;
+        std::size_t next_ = 0;
+    };
+}
+
+CachingPricingEngine::CachingPricingEngine(IPricingEngine& inner, std::string versionTag, PricingResultCache& cache)
+    : inner_(inner), versionTag_(std::move(versionTag)), cache_(cache),
+      latencyModel_(dynamic_cast<const BasePricingEngine*>(&inner)) {
+}
+
+std::string CachingPricingEngine::saltOf() const {
+    return versionTag_ + '\n' + inner_.getCacheTag();
+}
+
+std::uint64_t CachingPricingEngine::keyOf(const ITrade& trade) const {
+    return TradeHasher::hashOf(trade, saltOf());
+}
+
+std::string CachingPricingEngine::getCacheTag() const {
+    return inner_.getCacheTag();
+}
+
+void CachingPricingEngine::price(ITrade* trade, IScalarResultReceiver* resultReceiver) {
+    priceBatch(std::span<ITrade* const>(&trade, 1), resultReceiver, CancellationToken());
+}
+
+void CachingPricingEngine::priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) {
+    priceBatch(trades, resultReceiver, CancellationToken());
+}
+
+/*
+ * Hits are delivered first in one addResults call; the misses then go to the
+ * wrapped engine as a single batch, and their results are stored and passed
+ * on in a second call once the engine returns.
+ */
+void CachingPricingEngine::priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver,
+                                      const CancellationToken& token) {
+    if (resultReceiver == nullptr) {
+        throw std::invalid_argument("resultReceiver_");
+    }
+
+    std::vector<PricingResultCache::Entry> hitEntries;
+    std::vector<ITrade*> hitTrades;
+    std::vector<ITrade*> misses;
+    std::vector<std::uint64_t> missKeys;
+
+    const std::string salt = saltOf();
+    for (ITrade* trade : trades) {
+        if (trade == nullptr) {
+            throw std::invalid_argument("trade_");
+        }
+        std::uint64_t key = TradeHasher::hashOf(*trade, salt);
+        PricingResultCache::Entry entry;
+        if (cache_.find(key, entry)) {
+            hitEntries.push_back(std::move(entry));
+            hitTrades.push_back(trade);
+        } else {
+            misses.push_back(trade);
+            missKeys.push_back(key);
+        }
+    }
+
+    hits_.fetch_add(hitTrades.size());
+    misses_.fetch_add(misses.size());
+    if (latencyModel_ != nullptr && !hitTrades.empty()) {
+        auto full = latencyModel_->latencyFor(trades.size());
+        auto paid = misses.empty() ? std::chrono::milliseconds(0) : latencyModel_->latencyFor(misses.size());
+        savedMs_.fetch_add((full - paid).count());
+    }
+
+    if (!hitTrades.empty()) {
+        std::vector<ResultRecord> records;
+        records.reserve(hitTrades.size());
+        for (std::size_t i = 0; i < hitTrades.size(); ++i) {
+            const auto& entry = hitEntries[i];
+            records.push_back(ResultRecord { hitTrades[i]->getTradeIdView(), entry.value, entry.code, entry.detail });
+        }
+        resultReceiver->addResults(records);
+    }
+
+    if (!misses.empty()) {
+        ResultBatch results;
+        inner_.priceBatch(misses, &results, token);
+        StoringReceiver storing(cache_, misses, missKeys, *resultReceiver);
+        results.flushTo(storing);
+    }
+}
+
+IPricingEngine& CachingPricingEngine::getInner() const {
+    return inner_;
+}
+
+const std::string& CachingPricingEngine::getVersionTag() const {
+    return versionTag_;
+}
+
+std::uint64_t CachingPricingEngine::getHits() const {
+    return hits_.load();
+}
+
+std::uint64_t CachingPricingEngine::getMisses() const {
+    return misses_.load();
+}
+
+std::chrono::milliseconds CachingPricingEngine::getSavedLatency() const {
+    return std::chrono::milliseconds(savedMs_.load());
+}
@@ -0,0 +1,67 @@
+#ifndef CACHINGPRICINGENGINE_H
+#define CACHINGPRICINGENGINE_H
+
+#include "../Models/IPricingEngine.h"
+#include "PricingResultCache.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+
+class BasePricingEngine;
+
+/*
+ * CachingPricingEngine
+ *
+ * Decorator that answers from a PricingResultCache when a trade with the
+ * same content was priced before, and only sends the misses to the wrapped
+ * engine. The key is the TradeHasher hash of the trade salted with the
+ * version tag and the wrapped engine's getCacheTag() (model version, market
+ * snapshot, seed), so editing any priced field, a new model or market, or
+ * bumping the tag reprices the trade. The engine tag is read once per batch,
+ * so reconfiguring the engine between runs is picked up. Timeouts are never
+ * cached.
+ *
+ * The trade id is part of the key because the engines' outputs depend on
+ * it (per-trade random stream, per-trade error and warning tables).
+ *
+ * Counters are cumulative and safe to read while pricing runs. Saved time
+ * is estimated from the wrapped engine's latency model.
+ */
+class CachingPricingEngine : public IPricingEngine {
+public:
+    // Neither the engine nor the cache is owned.
+    CachingPricingEngine(IPricingEngine& inner, std::string versionTag, PricingResultCache& cache);
+
+    void price(ITrade* trade, IScalarResultReceiver* resultReceiver) override;
+    void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver) override;
+    void priceBatch(std::span<ITrade* const> trades, IScalarResultReceiver* resultReceiver,
+                    const CancellationToken& token) override;
+
+    std::uint64_t keyOf(const ITrade& trade) const;
+
+    // The wrapped engine's tag: a cache in front of a cache changes nothing.
+    std::string getCacheTag() const override;
+
+    IPricingEngine& getInner() const;
+    const std::string& getVersionTag() const;
+
+    std::uint64_t getHits() const;
+    std::uint64_t getMisses() const;
+    std::chrono::milliseconds getSavedLatency() const;
+
+private:
+    std::string saltOf() const;
+
+    IPricingEngine& inner_;
+    std::string versionTag_;
+    PricingResultCache& cache_;
+    const BasePricingEngine* latencyModel_;
+
+    std::atomic<std::uint64_t> hits_ { 0 };
+    std::atomic<std::uint64_t> misses_ { 0 };
+    std::atomic<std::int64_t> savedMs_ { 0 };
+};
+
+#endif // CACHINGPRICINGENGINE_H
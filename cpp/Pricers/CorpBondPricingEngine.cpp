@@ -0,0 +1,4 @@
+#include "CorpBondPricingEngine.h"
+#include "PricingEngineFactory.h"
+
+static PricingEngineFactory::Registrar<CorpBondPricingEngine> registrar("CorpBondPricingEngine");
@@ -1,15 +1,15 @@
 #ifndef CORPBONDPRICINGENGINE_H
 #define CORPBONDPRICINGENGINE_H
 
-#include "BasePricingEngine.h"
+#include "BondPricingEngine.h"
 
-class CorpBondPricingEngine : public BasePricingEngine {
+class CorpBondPricingEngine : public BondPricingEngine {
 public:
-    CorpBondPricingEngine() {
-        setDelay(8000);
+    // Assumed terms: 5.5% coupon, 7 years, semi-annual.
+    CorpBondPricingEngine() : BondPricingEngine(BondAnalytics::Terms { 5.5, 7, 2 }) {
+        setLatency(std::chrono::milliseconds(6000), std::chrono::milliseconds(2000));
         addSupportedTradeType("CorpBond");
     }
 };
 
 #endif // CORPBONDPRICINGENGINE_H
-
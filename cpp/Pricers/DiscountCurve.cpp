@@ -0,0 +1,43 @@
+#include "DiscountCurve.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+DiscountCurve::DiscountCurve(std::span<const double> tenors, std::span<const double> zeroRates) {
+    if (tenors.empty() || tenors.size() != zeroRates.size()) {
+        throw std::invalid_argument("A curve needs one zero rate per tenor and at least one tenor");
+    }
+
+    // Node at t = 0 (discount factor 1) so short dates interpolate too.
+    nodes_.reserve(tenors.size() + 1);
+    nodes_.push_back(Node { 0.0, 0.0, 0.0 });
+    for (std::size_t i = 0; i < tenors.size(); ++i) {
+        if (!(tenors[i] > nodes_.back().time)) {
+            throw std::invalid_argument("Curve tenors must be positive and increasing");
+        }
+        nodes_.push_back(Node { tenors[i], -zeroRates[i] * tenors[i], 0.0 });
+    }
+
+    for (std::size_t i = 0; i + 1 < nodes_.size(); ++i) {
+        nodes_[i].slope = (nodes_[i + 1].logDiscount - nodes_[i].logDiscount) / (nodes_[i + 1].time - nodes_[i].time);
+    }
+    nodes_.back().slope = nodes_[nodes_.size() - 2].slope;
+}
+
+double DiscountCurve::discount(double t) const {
+    if (t <= 0.0) {
+        return 1.0;
+    }
+    // Last node at or before t.
+    auto next = std::upper_bound(nodes_.begin(), nodes_.end(), t,
+        [](double time, const Node& node) { return time < node.time; });
+    const Node& node = *(next - 1);
+    return std::exp(node.logDiscount + node.slope * (t - node.time));
+}
+
+double DiscountCurve::zeroRate(double t) const {
+    if (t <= 0.0) {
+        return -nodes_.front().slope;
+    }
+    return -std::log(discount(t)) / t;
+}
@@ -0,0 +1,42 @@
+#ifndef DISCOUNTCURVE_H
+#define DISCOUNTCURVE_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/*
+ * DiscountCurve
+ *
+ * Discount factors for one currency, built from continuously compounded
+ * zero rates at increasing tenors (in years). Interpolation is linear in
+ * log discount factor - piecewise flat forward rates - and the last forward
+ * rate is extended beyond the final tenor.
+ *
+ * Everything a lookup needs is precomputed at construction into one
+ * contiguous array of nodes, each holding its time, log discount factor and
+ * the slope to the next node, so discount(t) is a short search over that
+ * array and a single exp(), with no division and no second array to touch.
+ * Immutable once built and safe to share between threads.
+ */
+class DiscountCurve {
+public:
+    DiscountCurve(std::span<const double> tenors, std::span<const double> zeroRates);
+
+    // t in years from the curve date; 1.0 for t <= 0.
+    double discount(double t) const;
+    double zeroRate(double t) const;
+
+    std::size_t size() const { return nodes_.size(); }
+
+private:
+    struct Node {
+        double time;
+        double logDiscount;
+        double slope;       // d(log discount)/dt up to the next node
+    };
+
+    std::vector<Node> nodes_;
+};
+
+#endif // DISCOUNTCURVE_H
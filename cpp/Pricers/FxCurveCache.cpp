@@ -0,0 +1,193 @@
+#include "FxCurveCache.h"
+#include "../Models/TradeHasher.h"
+#include "../Loaders/TradeFieldParser.h"
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    std::int64_t dayOf(FxCurveCache::TimePoint date) {
+        return std::chrono::floor<std::chrono::days>(date.time_since_epoch()).count();
+    }
+
+    std::vector<std::string> splitCsv(const std::string& line) {
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ',')) {
+            while (!field.empty() && (field.back() == '\r' || field.back() == ' ')) field.pop_back();
+            fields.push_back(field);
+        }
+        return fields;
+    }
+
+    // "1M" -> 1/12 year; D is ACT/365 days, W weeks.
+    double parseTenor(const std::string& label) {
+        if (label.size() < 2) {
+            throw std::invalid_argument("Invalid tenor: " + label);
+        }
+        double count = TradeFieldParser::parseDouble(std::string_view(label).substr(0, label.size() - 1));
+        switch (label.back()) {
+        case 'D': return count / 365.0;
+        case 'W': return count * 7.0 / 365.0;
+        case 'M': return count / 12.0;
+        case 'Y': return count;
+        default: throw std::invalid_argument("Invalid tenor: " + label);
+        }
+    }
+}
+
+FxCurveCache::FxCurveCache(TimePoint valuationDate, std::unordered_map<std::string, CurrencyMarket> market)
+    : valuationDate_(valuationDate), market_(std::move(market)) {
+    for (const auto& kv : market_) {
+        if (!(kv.second.perUsd > 0.0)) {
+            throw std::invalid_argument("Spot rate for " + kv.first + " must be positive");
+        }
+    }
+
+    // Currencies in code order so the id does not depend on hash map layout.
+    std::vector<const std::string*> codes;
+    for (const auto& kv : market_) {
+        codes.push_back(&kv.first);
+    }
+    std::sort(codes.begin(), codes.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+
+    TradeHasher hasher;
+    hasher.add(valuationDate_);
+    for (const std::string* code : codes) {
+        const CurrencyMarket& market = market_.at(*code);
+        hasher.add(*code);
+        hasher.add(market.perUsd);
+        for (double tenor : market.tenors) hasher.add(tenor);
+        for (double rate : market.zeroRates) hasher.add(rate);
+    }
+    snapshotId_ = hasher.hash();
+}
+
+std::shared_ptr<FxCurveCache> FxCurveCache::load(const std::string& filename) {
+    std::ifstream stream(filename);
+    if (!stream.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+
+    try {
+        std::string line;
+        std::vector<std::string> fields;
+        if (!std::getline(stream, line) || (fields = splitCsv(line)).size() != 2 || fields[0] != "ValuationDate") {
+            throw std::invalid_argument("expected ValuationDate,<date>");
+        }
+        TimePoint valuationDate = TradeFieldParser::parseDate(fields[1]);
+
+        if (!std::getline(stream, line) || (fields = splitCsv(line)).size() < 3 || fields[0] != "Currency") {
+            throw std::invalid_argument("expected Currency,PerUsd,<tenors>");
+        }
+        std::vector<double> tenors;
+        for (std::size_t i = 2; i < fields.size(); ++i) {
+            tenors.push_back(parseTenor(fields[i]));
+        }
+
+        std::unordered_map<std::string, CurrencyMarket> market;
+        while (std::getline(stream, line)) {
+            fields = splitCsv(line);
+            if (fields.empty() || (fields.size() == 1 && fields[0].empty())) continue;
+            if (fields.size() != tenors.size() + 2) {
+                throw std::invalid_argument("wrong number of fields for " + fields[0]);
+            }
+            CurrencyMarket currency;
+            currency.perUsd = TradeFieldParser::parseDouble(fields[1]);
+            currency.tenors = tenors;
+            for (std::size_t i = 2; i < fields.size(); ++i) {
+                currency.zeroRates.push_back(TradeFieldParser::parseDouble(fields[i]));
+            }
+            if (!market.emplace(fields[0], std::move(currency)).second) {
+                throw std::invalid_argument("duplicate currency " + fields[0]);
+            }
+        }
+        return std::make_shared<FxCurveCache>(valuationDate, std::move(market));
+    } catch (const std::invalid_argument& e) {
+        throw std::runtime_error("Invalid FX market file " + filename + ": " + e.what());
+    }
+}
+
+std::shared_ptr<FxCurveCache> FxCurveCache::sample() {
+    static const std::shared_ptr<FxCurveCache> cache = [] {
+        using namespace std::chrono;
+        const std::vector<double> tenors = { 1.0 / 12, 0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0 };
+        std::unordered_map<std::string, CurrencyMarket> market {
+            { "USD", { 1.0,     tenors, { 0.0020, 0.0030, 0.0045, 0.0060, 0.0075, 0.0080, 0.0172, 0.0289 } } },
+            { "EUR", { 0.7716,  tenors, { 0.0005, 0.0010, 0.0020, 0.0030, 0.0040, 0.0080, 0.0160, 0.0230 } } },
+            { "GBP", { 0.6216,  tenors, { 0.0040, 0.0045, 0.0060, 0.0070, 0.0075, 0.0095, 0.0180, 0.0300 } } },
+            { "CHF", { 0.9327,  tenors, { -0.0005, 0.0000, 0.0005, 0.0010, 0.0015, 0.0040, 0.0090, 0.0150 } } },
+            { "JPY", { 78.68,   tenors, { 0.0010, 0.0015, 0.0025, 0.0030, 0.0035, 0.0040, 0.0080, 0.0190 } } }
+        };
+        return std::make_shared<FxCurveCache>(sys_days(year(2012) / October / 15), std::move(market));
+    }();
+    return cache;
+}
+
+const DiscountCurve* FxCurveCache::getCurve(std::string_view currency) {
+    std::string code(currency);
+    {
+        std::shared_lock<std::shared_mutex> lock(curvesMutex_);
+        auto it = curves_.find(code);
+        if (it != curves_.end()) {
+            return it->second.get();
+        }
+    }
+
+    auto market = market_.find(code);
+    if (market == market_.end()) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(curvesMutex_);
+    auto it = curves_.find(code);
+    if (it == curves_.end()) {
+        auto curve = std::make_unique<DiscountCurve>(market->second.tenors, market->second.zeroRates);
+        it = curves_.emplace(std::move(code), std::move(curve)).first;
+        ++curvesBuilt_;
+    }
+    return it->second.get();
+}
+
+bool FxCurveCache::getForward(Symbol pair, TimePoint valueDate, Forward& forward) {
+    const ForwardKey key { pair, dayOf(valueDate) };
+    {
+        std::shared_lock<std::shared_mutex> lock(forwardsMutex_);
+        auto it = forwards_.find(key);
+        if (it != forwards_.end()) {
+            forward = it->second;
+            return true;
+        }
+    }
+
+    std::string_view codes = pair.view();
+    std::int64_t days = key.day - dayOf(valuationDate_);
+    if (codes.size() != 6 || days < 0) {
+        return false;
+    }
+    auto base = market_.find(std::string(codes.substr(0, 3)));
+    auto quote = market_.find(std::string(codes.substr(3, 3)));
+    if (base == market_.end() || quote == market_.end()) {
+        return false;
+    }
+
+    // ACT/365 from the valuation date.
+    double t = static_cast<double>(days) / 365.0;
+    Forward computed;
+    computed.spot = quote->second.perUsd / base->second.perUsd;
+    computed.quoteDiscount = getCurve(quote->first)->discount(t);
+    computed.outright = computed.spot * getCurve(base->first)->discount(t) / computed.quoteDiscount;
+    computed.points = computed.outright - computed.spot;
+
+    std::unique_lock<std::shared_mutex> lock(forwardsMutex_);
+    auto inserted = forwards_.try_emplace(key, computed);
+    if (inserted.second) {
+        ++forwardsComputed_;
+    }
+    forward = inserted.first->second;
+    return true;
+}
@@ -0,0 +1,115 @@
+#ifndef FXCURVECACHE_H
+#define FXCURVECACHE_H
+
+#include "DiscountCurve.h"
+#include "../Models/Symbol.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * FxCurveCache
+ *
+ * Market data for FX pricing as of one valuation date: a spot rate against
+ * USD and a zero curve per currency. Work is done lazily and kept:
+ *
+ *   - a currency's DiscountCurve is built the first time it is needed, and
+ *   - a pair's forward for a value date (spot, outright, points and the
+ *     quote-currency discount factor) is computed once and then shared by
+ *     every trade on that pair and date.
+ *
+ * The outright follows covered interest parity,
+ *   F = S * DF_base(T) / DF_quote(T),
+ * with pairs quoted as base + quote currency code ("EURUSD"), the way
+ * FxTradeLoader builds the instrument. Thread-safe; lookups of cached
+ * entries only take a shared lock.
+ */
+class FxCurveCache {
+public:
+    struct CurrencyMarket {
+        double perUsd = 1.0;                // units of the currency per USD
+        std::vector<double> tenors;         // years
+        std::vector<double> zeroRates;      // continuously compounded
+    };
+
+    struct Forward {
+        double spot = 0.0;
+        double outright = 0.0;
+        double points = 0.0;                // outright - spot
+        double quoteDiscount = 1.0;         // to discount quote-currency flows on the value date
+    };
+
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    FxCurveCache(TimePoint valuationDate, std::unordered_map<std::string, CurrencyMarket> market);
+
+    /*
+     * Reads a market data file (see PricingConfig/FxMarket.dat):
+     *
+     *   ValuationDate,2012-10-15
+     *   Currency,PerUsd,1M,3M,1Y,...     (tenors in D, W, M or Y)
+     *   USD,1.0,0.0020,0.0030,0.0060,... (spot per USD, then zero rates)
+     *
+     * Throws std::runtime_error when the file cannot be read or is malformed.
+     */
+    static std::shared_ptr<FxCurveCache> load(const std::string& filename);
+
+    /*
+     * Test fixture: a representative market as of 2012-10-15, the date of
+     * the sample FxTrades.dat, covering its currencies. Production markets
+     * come from load(), normally through the Engine element's marketData.
+     */
+    static std::shared_ptr<FxCurveCache> sample();
+
+    TimePoint getValuationDate() const { return valuationDate_; }
+
+    // Hash of the valuation date and market data: equal ids, equal prices.
+    std::uint64_t getSnapshotId() const { return snapshotId_; }
+
+    // Built on first use; nullptr for a currency with no market data.
+    const DiscountCurve* getCurve(std::string_view currency);
+
+    /*
+     * False when the pair is not two known currency codes or the value date
+     * is before the valuation date (the trade has settled).
+     */
+    bool getForward(Symbol pair, TimePoint valueDate, Forward& forward);
+
+    // How much work has actually been done, for tests and diagnostics.
+    std::size_t getCurvesBuilt() const { return curvesBuilt_.load(); }
+    std::size_t getForwardsComputed() const { return forwardsComputed_.load(); }
+
+private:
+    struct ForwardKey {
+        Symbol pair;
+        std::int64_t day;       // value date, days since the epoch
+
+        bool operator==(const ForwardKey& other) const { return pair == other.pair && day == other.day; }
+    };
+
+    struct ForwardKeyHash {
+        std::size_t operator()(const ForwardKey& key) const noexcept {
+            return std::hash<Symbol>()(key.pair) ^ (static_cast<std::size_t>(key.day) * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    TimePoint valuationDate_;
+    std::unordered_map<std::string, CurrencyMarket> market_;
+    std::uint64_t snapshotId_ = 0;
+
+    std::shared_mutex curvesMutex_;
+    std::unordered_map<std::string, std::unique_ptr<DiscountCurve>> curves_;
+    std::shared_mutex forwardsMutex_;
+    std::unordered_map<ForwardKey, Forward, ForwardKeyHash> forwards_;
+
+    std::atomic<std::size_t> curvesBuilt_ { 0 };
+    std::atomic<std::size_t> forwardsComputed_ { 0 };
+};
+
+#endif // FXCURVECACHE_H
@@ -0,0 +1,33 @@
+#include "FxPricingEngine.h"
+#include "PricingEngineFactory.h"
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+static PricingEngineFactory::Registrar<FxPricingEngine> registrar("FxPricingEngine");
+
+void FxPricingEngine::setCurveCache(std::shared_ptr<FxCurveCache> curves) {
+    if (curves == nullptr) {
+        throw std::invalid_argument("curves cannot be null");
+    }
+    curves_ = std::move(curves);
+}
+
+std::string FxPricingEngine::getCacheTag() const {
+    if (curves_ == nullptr) {
+        return "fx-forward/v" + std::to_string(ModelVersion) + ";market=none";
+    }
+    char snapshot[17];
+    std::snprintf(snapshot, sizeof(snapshot), "%016llx", static_cast<unsigned long long>(curves_->getSnapshotId()));
+    return "fx-forward/v" + std::to_string(ModelVersion) + ";market=" + snapshot;
+}
+
+double FxPricingEngine::calculateResult(const ITrade& trade) const {
+    // A trade without a value date reads as the epoch, long settled.
+    FxCurveCache::Forward forward;
+    if (curves_ == nullptr || !curves_->getForward(trade.getInstrumentSymbol(), trade.getValueDate(), forward)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return trade.getNotional() * (forward.outright - trade.getRate()) * forward.quoteDiscount;
+}
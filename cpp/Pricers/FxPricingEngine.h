@@ -2,15 +2,49 @@
 #define FXPRICINGENGINE_H
 
 #include "BasePricingEngine.h"
+#include "FxCurveCache.h"
+#include <memory>
 
+/*
+ * FxPricingEngine
+ *
+ * Values FX spots and forwards alike, as the present value in the quote
+ * currency of buying the trade's notional of the base currency at the
+ * trade's rate on its value date:
+ *   notional * (outright - rate) * DF_quote(value date)
+ * A spot is just a forward with a short value date. Outrights come from
+ * the shared FxCurveCache, so trades on the same pair and value date reuse
+ * one forward computation. Trades on unknown currencies, or whose value
+ * date is before the valuation date, get no value.
+ *
+ * The market is injected: PricingEngineRegistry loads the Engine element's
+ * marketData file, and other callers use setCurveCache. Until then the
+ * engine has no market and no trade gets a value.
+ */
 class FxPricingEngine : public BasePricingEngine {
 public:
     FxPricingEngine() {
-        setDelay(2000);
+        setLatency(std::chrono::milliseconds(1500), std::chrono::milliseconds(500));
         addSupportedTradeType("FxSpot");
         addSupportedTradeType("FxFwd");
     }
+
+    // nullptr until a market has been set.
+    const std::shared_ptr<FxCurveCache>& getCurveCache() const { return curves_; }
+    // Configuration: not to be called while the engine is pricing.
+    void setCurveCache(std::shared_ptr<FxCurveCache> curves);
+
+    // Model version and the market snapshot the curves were built from.
+    std::string getCacheTag() const override;
+
+protected:
+    double calculateResult(const ITrade& trade) const override;
+
+private:
+    // Bump whenever a change alters the values the engine reports.
+    static constexpr int ModelVersion = 1;
+
+    std::shared_ptr<FxCurveCache> curves_;
 };
 
 #endif // FXPRICINGENGINE_H
-
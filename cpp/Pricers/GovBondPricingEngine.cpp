@@ -0,0 +1,4 @@
+#include "GovBondPricingEngine.h"
+#include "PricingEngineFactory.h"
+
+static PricingEngineFactory::Registrar<GovBondPricingEngine> registrar("GovBondPricingEngine");
@@ -1,15 +1,16 @@
 #ifndef GOVBONDPRICINGENGINE_H
 #define GOVBONDPRICINGENGINE_H
 
-#include "BasePricingEngine.h"
+#include "BondPricingEngine.h"
 
-class GovBondPricingEngine : public BasePricingEngine {
+class GovBondPricingEngine : public BondPricingEngine {
 public:
-    GovBondPricingEngine() {
-        setDelay(5000);
+    // Assumed terms: 4% coupon, 10 years, semi-annual.
+    GovBondPricingEngine() : BondPricingEngine(BondAnalytics::Terms { 4.0, 10, 2 }) {
+        // Fixed + per-trade latency; a single trade still takes 5000 ms.
+        setLatency(std::chrono::milliseconds(4000), std::chrono::milliseconds(1000));
         addSupportedTradeType("GovBond");
     }
 };
 
 #endif // GOVBONDPRICINGENGINE_H
-
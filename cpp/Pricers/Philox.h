@@ -0,0 +1,61 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/*
+ * Philox4x32-10
+ *
+ * Counter-based random number generator (Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3"). Each output block is a pure function of a
+ * 128-bit counter and a 64-bit key, so there is no generator state to share
+ * between threads: any thread can compute the numbers for any counter, in
+ * any order, and always get the same values.
+ */
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            if (round != 0) {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * counter[0];
+            std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * counter[2];
+            counter = {
+                static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<std::uint32_t>(p0)
+            };
+        }
+        return counter;
+    }
+
+    // Uniform double in [0, 1) for stream `stream` of the given 64-bit id.
+    static double uniform(std::uint64_t seed, std::uint64_t id, std::uint64_t stream = 0) {
+        Counter block = generate(
+            { static_cast<std::uint32_t>(id), static_cast<std::uint32_t>(id >> 32),
+              static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) },
+            { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) });
+        std::uint64_t bits = (static_cast<std::uint64_t>(block[0]) << 21) ^ (block[1] >> 11);
+        return static_cast<double>(bits & ((std::uint64_t(1) << 53) - 1)) * (1.0 / 9007199254740992.0);
+    }
+
+    // Stable 64-bit id for a string key (FNV-1a), identical on every platform.
+    static std::uint64_t idOf(std::string_view key) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : key) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+#endif // PHILOX_H
@@ -0,0 +1,43 @@
+#include "PricingEngineFactory.h"
+#include <stdexcept>
+
+PricingEngineFactory& PricingEngineFactory::instance() {
+    // Registrars run during static initialisation of other translation
+    // units, so the factory must be constructed on first use.
+    static PricingEngineFactory factory;
+    return factory;
+}
+
+void PricingEngineFactory::registerEngine(const std::string& name, Creator creator) {
+    if (name.empty() || !creator) {
+        throw std::invalid_argument("Pricing engine registration needs a name and a creator");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!creators_.emplace(name, std::move(creator)).second) {
+        throw std::logic_error("Pricing engine registered twice: " + name);
+    }
+}
+
+bool PricingEngineFactory::isRegistered(std::string_view typeName) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return creators_.find(std::string(shortName(typeName))) != creators_.end();
+}
+
+std::unique_ptr<IPricingEngine> PricingEngineFactory::create(std::string_view typeName) const {
+    Creator creator;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = creators_.find(std::string(shortName(typeName)));
+        if (it == creators_.end()) {
+            throw std::runtime_error("Unknown pricing engine type: " + std::string(typeName));
+        }
+        creator = it->second;
+    }
+    return creator();
+}
+
+std::string_view PricingEngineFactory::shortName(std::string_view typeName) {
+    auto pos = typeName.find_last_of(".:");
+    return pos == std::string_view::npos ? typeName : typeName.substr(pos + 1);
+}
@@ -0,0 +1,60 @@
+#ifndef PRICINGENGINEFACTORY_H
+#define PRICINGENGINEFACTORY_H
+
+#include "../Models/IPricingEngine.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+ * PricingEngineFactory
+ *
+ * Process-wide map from engine class name to a creator function. Each
+ * engine registers itself from its own translation unit with a static
+ * Registrar, so adding an engine does not touch any pricer:
+ *
+ *     static PricingEngineFactory::Registrar<MyEngine> registrar("MyEngine");
+ *
+ * create() accepts the names used in PricingEngines.xml, which may be
+ * qualified ("HmxLabs.TechTest.Pricers.GovBondPricingEngine"); only the part
+ * after the last '.' or ':' is used for the lookup.
+ */
+class PricingEngineFactory {
+public:
+    using Creator = std::function<std::unique_ptr<IPricingEngine>()>;
+
+    template <typename Engine>
+    class Registrar {
+    public:
+        explicit Registrar(const std::string& name) {
+            PricingEngineFactory::instance().registerEngine(name, []() {
+                return std::unique_ptr<IPricingEngine>(new Engine());
+            });
+        }
+    };
+
+    static PricingEngineFactory& instance();
+
+    // Throws if the name is already registered.
+    void registerEngine(const std::string& name, Creator creator);
+    bool isRegistered(std::string_view typeName) const;
+
+    // Throws std::runtime_error for names nobody registered.
+    std::unique_ptr<IPricingEngine> create(std::string_view typeName) const;
+
+    static std::string_view shortName(std::string_view typeName);
+
+    PricingEngineFactory(const PricingEngineFactory&) = delete;
+    PricingEngineFactory& operator=(const PricingEngineFactory&) = delete;
+
+private:
+    PricingEngineFactory() = default;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Creator> creators_;
+};
+
+#endif // PRICINGENGINEFACTORY_H
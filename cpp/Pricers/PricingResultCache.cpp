@@ -0,0 +1,186 @@
+#include "PricingResultCache.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace {
+    constexpr char Magic[8] = { 'P', 'R', 'C', 'A', 'C', 'H', 'E', '\0' };
+    constexpr std::uint32_t Version = 1;
+
+    // FNV-1a, continued across calls so the whole record stream is covered.
+    void mix(std::uint64_t& hash, const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ofstream& out, std::uint64_t& hash, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        mix(hash, &value, sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream& in, std::uint64_t& hash, T& value) {
+        if (!in.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+            return false;
+        }
+        mix(hash, &value, sizeof(T));
+        return true;
+    }
+}
+
+PricingResultCache::PricingResultCache(std::size_t shardCount) {
+    if (shardCount == 0) {
+        throw std::invalid_argument("shardCount must be positive");
+    }
+    shards_.reserve(shardCount);
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+// Keys are already well-mixed hashes; the high bits pick the shard so the
+// low bits stay useful to each shard's own hash table.
+PricingResultCache::Shard& PricingResultCache::shardFor(std::uint64_t key) const {
+    return *shards_[(key >> 40) % shards_.size()];
+}
+
+bool PricingResultCache::find(std::uint64_t key, Entry& entry) const {
+    Shard& shard = shardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return false;
+    }
+    entry = it->second;
+    return true;
+}
+
+void PricingResultCache::store(std::uint64_t key, Entry entry) {
+    Shard& shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.entries.insert_or_assign(key, std::move(entry));
+}
+
+std::size_t PricingResultCache::size() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        total += shard->entries.size();
+    }
+    return total;
+}
+
+void PricingResultCache::clear() {
+    for (const auto& shard : shards_) {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        shard->entries.clear();
+    }
+}
+
+/*
+ * File layout (host byte order):
+ *   magic[8], version u32, count u64,
+ *   count x { key u64, value f64, code u8, detailLength u32, detail bytes },
+ *   checksum u64 (FNV-1a over everything before it)
+ *
+ * Records are staged and only merged in once the checksum matches.
+ */
+std::size_t PricingResultCache::load(const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in.is_open()) {
+        return 0;
+    }
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    char magic[sizeof(Magic)];
+    std::uint32_t version = 0;
+    std::uint64_t count = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, Magic, sizeof(Magic)) != 0) {
+        return 0;
+    }
+    mix(hash, magic, sizeof(magic));
+    if (!readValue(in, hash, version) || version != Version || !readValue(in, hash, count)) {
+        return 0;
+    }
+
+    std::vector<std::pair<std::uint64_t, Entry>> staged;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        std::uint64_t key = 0;
+        Entry entry;
+        std::uint8_t code = 0;
+        std::uint32_t length = 0;
+        if (!readValue(in, hash, key) || !readValue(in, hash, entry.value)
+            || !readValue(in, hash, code) || !readValue(in, hash, length)
+            || code > static_cast<std::uint8_t>(ResultCode::Timeout) || length > (1u << 20)) {
+            return 0;
+        }
+        entry.code = static_cast<ResultCode>(code);
+        entry.detail.resize(length);
+        if (length != 0 && !in.read(entry.detail.data(), length)) {
+            return 0;
+        }
+        mix(hash, entry.detail.data(), length);
+        staged.emplace_back(key, std::move(entry));
+    }
+
+    std::uint64_t checksum = 0;
+    if (!in.read(reinterpret_cast<char*>(&checksum), sizeof(checksum)) || checksum != hash) {
+        return 0;
+    }
+
+    for (auto& record : staged) {
+        store(record.first, std::move(record.second));
+    }
+    return staged.size();
+}
+
+void PricingResultCache::save(const std::string& file) const {
+    std::vector<std::pair<std::uint64_t, Entry>> snapshot;
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        snapshot.insert(snapshot.end(), shard->entries.begin(), shard->entries.end());
+    }
+
+    const std::string tempFile = file + ".tmp";
+    {
+        std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Cannot write pricing cache: " + tempFile);
+        }
+
+        std::uint64_t hash = 14695981039346656037ULL;
+        out.write(Magic, sizeof(Magic));
+        mix(hash, Magic, sizeof(Magic));
+        writeValue(out, hash, Version);
+        writeValue(out, hash, static_cast<std::uint64_t>(snapshot.size()));
+
+        for (const auto& record : snapshot) {
+            writeValue(out, hash, record.first);
+            writeValue(out, hash, record.second.value);
+            writeValue(out, hash, static_cast<std::uint8_t>(record.second.code));
+            writeValue(out, hash, static_cast<std::uint32_t>(record.second.detail.size()));
+            out.write(record.second.detail.data(), static_cast<std::streamsize>(record.second.detail.size()));
+            mix(hash, record.second.detail.data(), record.second.detail.size());
+        }
+        out.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+
+        // Close first so a failure in the final flush is caught too, and never
+        // rename a truncated file over a good cache.
+        out.close();
+        if (!out) {
+            std::error_code ignored;
+            std::filesystem::remove(tempFile, ignored);
+            throw std::runtime_error("Cannot write pricing cache: " + tempFile);
+        }
+    }
+
+    std::filesystem::rename(tempFile, file);
+}
@@ -0,0 +1,56 @@
+#ifndef PRICINGRESULTCACHE_H
+#define PRICINGRESULTCACHE_H
+
+#include "../Models/ResultRecord.h"
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * PricingResultCache
+ *
+ * Pricing outcomes keyed by a 64-bit content hash (see CachingPricingEngine).
+ * Entries are spread over independently locked shards by key, so concurrent
+ * workers only contend when they touch the same shard, and lookups take a
+ * shared lock.
+ *
+ * The cache can be written to and read back from a binary file so a
+ * restarted process starts warm. A missing, foreign-version or corrupt file
+ * loads nothing rather than failing.
+ */
+class PricingResultCache {
+public:
+    struct Entry {
+        double value = 0.0;
+        ResultCode code = ResultCode::Ok;
+        std::string detail;
+    };
+
+    explicit PricingResultCache(std::size_t shardCount = 64);
+
+    bool find(std::uint64_t key, Entry& entry) const;
+    void store(std::uint64_t key, Entry entry);
+
+    std::size_t size() const;
+    void clear();
+
+    // Returns the number of entries read; existing entries are kept.
+    std::size_t load(const std::string& file);
+    // Writes to a temporary file and renames it into place.
+    void save(const std::string& file) const;
+
+private:
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::uint64_t, Entry> entries;
+    };
+
+    Shard& shardFor(std::uint64_t key) const;
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+#endif // PRICINGRESULTCACHE_H
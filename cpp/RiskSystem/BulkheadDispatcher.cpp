@@ -0,0 +1,80 @@
+#include "BulkheadDispatcher.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+BulkheadDispatcher::BulkheadDispatcher(std::vector<const IPricingEngine*> engines,
+                                       const std::vector<std::size_t>& order,
+                                       std::unordered_map<const IPricingEngine*, unsigned int> limits)
+    : engines_(std::move(engines)), limits_(std::move(limits)) {
+    if (order.size() != engines_.size()) {
+        throw std::invalid_argument("Dispatch order must cover every batch");
+    }
+    for (std::size_t batch : order) {
+        if (batch >= engines_.size()) {
+            throw std::out_of_range("Dispatch order refers to an unknown batch");
+        }
+    }
+
+    // Kept reversed so the preferred batch sits at the back and is cheap to take.
+    pending_.assign(order.rbegin(), order.rend());
+}
+
+bool BulkheadDispatcher::hasRoom(const IPricingEngine* engine) const {
+    auto limit = limits_.find(engine);
+    if (limit == limits_.end() || limit->second == 0) {
+        return true;
+    }
+    auto active = active_.find(engine);
+    return active == active_.end() || active->second < limit->second;
+}
+
+bool BulkheadDispatcher::acquire(std::size_t& batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        if (pending_.empty()) {
+            return false;
+        }
+
+        for (auto it = pending_.rbegin(); it != pending_.rend(); ++it) {
+            const IPricingEngine* engine = engines_[*it];
+            if (!hasRoom(engine)) {
+                continue;
+            }
+
+            batch = *it;
+            pending_.erase(std::next(it).base());
+
+            unsigned int running = ++active_[engine];
+            unsigned int& peak = peak_[engine];
+            peak = std::max(peak, running);
+            return true;
+        }
+
+        // Everything left is waiting on a saturated engine.
+        released_.wait(lock);
+    }
+}
+
+void BulkheadDispatcher::release(std::size_t batch) {
+    if (batch >= engines_.size()) {
+        throw std::out_of_range("Unknown batch released");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto active = active_.find(engines_[batch]);
+        if (active == active_.end() || active->second == 0) {
+            throw std::logic_error("Batch released without being acquired");
+        }
+        --active->second;
+    }
+    released_.notify_all();
+}
+
+unsigned int BulkheadDispatcher::getPeakConcurrency(const IPricingEngine* engine) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = peak_.find(engine);
+    return it == peak_.end() ? 0 : it->second;
+}
@@ -0,0 +1,55 @@
+#ifndef BULKHEADDISPATCHER_H
+#define BULKHEADDISPATCHER_H
+
+#include "../Models/IPricingEngine.h"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * BulkheadDispatcher
+ *
+ * Hands out batches to pricing workers while keeping every engine within
+ * its concurrency limit. Batches are offered in the given preference order,
+ * but a batch whose engine is already at its limit is passed over, so a
+ * worker takes the next batch for an engine that still has room instead
+ * of queueing behind the saturated one. A worker only waits when every
+ * remaining batch belongs to a saturated engine, and is woken as soon as
+ * one of those engines finishes a batch.
+ *
+ * Engines without an entry in the limits map, or with a limit of 0, are
+ * unlimited. Thread-safe.
+ */
+class BulkheadDispatcher {
+public:
+    // engines[i] is the engine of batch i; order lists batch indices, most
+    // preferred first, and must cover every batch exactly once.
+    BulkheadDispatcher(std::vector<const IPricingEngine*> engines,
+                       const std::vector<std::size_t>& order,
+                       std::unordered_map<const IPricingEngine*, unsigned int> limits);
+
+    // Blocks until a batch can run; returns false once none are left.
+    bool acquire(std::size_t& batch);
+
+    // Must be called once for every batch returned by acquire.
+    void release(std::size_t batch);
+
+    // Highest number of batches seen running at once on the engine.
+    unsigned int getPeakConcurrency(const IPricingEngine* engine) const;
+
+private:
+    bool hasRoom(const IPricingEngine* engine) const;
+
+    std::vector<const IPricingEngine*> engines_;
+    std::vector<std::size_t> pending_;
+    std::unordered_map<const IPricingEngine*, unsigned int> limits_;
+    std::unordered_map<const IPricingEngine*, unsigned int> active_;
+    std::unordered_map<const IPricingEngine*, unsigned int> peak_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable released_;
+};
+
+#endif // BULKHEADDISPATCHER_H
@@ -0,0 +1,60 @@
+#ifndef ENGINEBATCHER_H
+#define ENGINEBATCHER_H
+
+#include "../Models/IPricingEngine.h"
+#include "../Models/ITrade.h"
+#include "../Models/Symbol.h"
+#include <unordered_map>
+#include <vector>
+
+/*
+ * EngineBatcher
+ *
+ * Groups trades by the pricing engine registered for their trade type so
+ * each engine can be called once per batch. Batches come out in the order
+ * their engine was first seen, trades within a batch keep their input order,
+ * and a batch is closed once it reaches maxBatchSize (0 means unbounded).
+ */
+class EngineBatcher {
+public:
+    struct Batch {
+        IPricingEngine* engine;
+        std::vector<ITrade*> trades;
+    };
+
+    explicit EngineBatcher(const std::unordered_map<Symbol, IPricingEngine*>& pricers, std::size_t maxBatchSize = 0)
+        : pricers_(pricers), maxBatchSize_(maxBatchSize) {}
+
+    // Returns false, and keeps nothing, if no engine handles the trade type.
+    bool add(ITrade* trade) {
+        auto it = pricers_.find(trade->getTradeTypeSymbol());
+        if (it == pricers_.end()) {
+            return false;
+        }
+
+        IPricingEngine* engine = it->second;
+        auto open = open_.find(engine);
+        if (open == open_.end() || (maxBatchSize_ != 0 && batches_[open->second].trades.size() >= maxBatchSize_)) {
+            batches_.push_back(Batch { engine, {} });
+            open_[engine] = batches_.size() - 1;
+            open = open_.find(engine);
+        }
+        batches_[open->second].trades.push_back(trade);
+        return true;
+    }
+
+    const std::vector<Batch>& getBatches() const { return batches_; }
+
+    void clear() {
+        batches_.clear();
+        open_.clear();
+    }
+
+private:
+    const std::unordered_map<Symbol, IPricingEngine*>& pricers_;
+    std::size_t maxBatchSize_;
+    std::vector<Batch> batches_;
+    std::unordered_map<IPricingEngine*, std::size_t> open_;
+};
+
+#endif // ENGINEBATCHER_H
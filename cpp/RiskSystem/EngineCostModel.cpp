@@ -0,0 +1,57 @@
+#include "EngineCostModel.h"
+#include "../Pricers/BasePricingEngine.h"
+#include "../Pricers/CachingPricingEngine.h"
+#include <stdexcept>
+#include <typeinfo>
+
+EngineCostModel::EngineCostModel(double smoothing) : smoothing_(smoothing) {
+    if (!(smoothing > 0.0 && smoothing <= 1.0)) {
+        throw std::invalid_argument("smoothing must be in (0, 1]");
+    }
+}
+
+// A caching decorator is modelled as the engine behind it; the learned ratio
+// then absorbs the time its hits save.
+IPricingEngine* EngineCostModel::underlying(IPricingEngine* engine) {
+    while (auto* caching = dynamic_cast<CachingPricingEngine*>(engine)) {
+        engine = &caching->getInner();
+    }
+    return engine;
+}
+
+double EngineCostModel::prior(IPricingEngine* engine, std::size_t tradeCount) {
+    engine = underlying(engine);
+    if (auto* base = dynamic_cast<BasePricingEngine*>(engine)) {
+        return static_cast<double>(base->latencyFor(tradeCount).count());
+    }
+    return static_cast<double>(tradeCount);
+}
+
+double EngineCostModel::getRatio(IPricingEngine* engine) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    IPricingEngine* model = underlying(engine);
+    auto it = ratios_.find(std::type_index(typeid(*model)));
+    return it != ratios_.end() ? it->second : 1.0;
+}
+
+double EngineCostModel::expectedCost(IPricingEngine* engine, std::size_t tradeCount) const {
+    return prior(engine, tradeCount) * getRatio(engine);
+}
+
+void EngineCostModel::record(IPricingEngine* engine, std::size_t tradeCount, double actualMs) {
+    double expected = prior(engine, tradeCount);
+    if (expected <= 0.0) {
+        // A zero-latency prior gives no scale to correct.
+        return;
+    }
+
+    double observed = actualMs / expected;
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::type_index key(typeid(*underlying(engine)));
+    auto it = ratios_.find(key);
+    if (it == ratios_.end()) {
+        ratios_.emplace(key, observed);
+    } else {
+        it->second += smoothing_ * (observed - it->second);
+    }
+}
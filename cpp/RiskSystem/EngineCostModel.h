@@ -0,0 +1,47 @@
+#ifndef ENGINECOSTMODEL_H
+#define ENGINECOSTMODEL_H
+
+#include "../Models/IPricingEngine.h"
+#include <cstddef>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+/*
+ * EngineCostModel
+ *
+ * Expected wall-clock cost (ms) of handing a batch to an engine. The prior
+ * is the engine's own latency model (BasePricingEngine::latencyFor, which
+ * generalises getDelay to batches); engines that do not derive from
+ * BasePricingEngine get a nominal 1 ms per trade.
+ *
+ * Each observed run updates an exponentially weighted moving average of
+ * actual / prior per engine class, and the estimate is prior * that ratio,
+ * so the model tracks engines that are consistently slower or faster than
+ * their configuration says. Estimates are keyed by the engine's dynamic
+ * type, so they survive the pricers recreating engines between runs.
+ * Thread-safe.
+ */
+class EngineCostModel {
+public:
+    // smoothing is the weight of the newest observation, in (0, 1].
+    explicit EngineCostModel(double smoothing = 0.3);
+
+    double expectedCost(IPricingEngine* engine, std::size_t tradeCount) const;
+    void record(IPricingEngine* engine, std::size_t tradeCount, double actualMs);
+
+    // Current actual / prior correction for an engine (1.0 if never observed).
+    double getRatio(IPricingEngine* engine) const;
+
+    // The engine doing the work behind any caching decorators.
+    static IPricingEngine* underlying(IPricingEngine* engine);
+
+private:
+    static double prior(IPricingEngine* engine, std::size_t tradeCount);
+
+    double smoothing_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::type_index, double> ratios_;
+};
+
+#endif // ENGINECOSTMODEL_H
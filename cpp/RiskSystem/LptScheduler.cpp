@@ -0,0 +1,87 @@
+#include "LptScheduler.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+LptScheduler::Plan LptScheduler::plan(const std::vector<double>& costs, unsigned int workers) {
+    return plan(costs, workers, std::vector<std::size_t>(), std::vector<unsigned int>());
+}
+
+/*
+ * Simulated in time rather than with a least-loaded heap, since with caps a
+ * worker can sit idle while jobs are left. Without caps both give the same
+ * plan: every free worker takes the next job in order, lowest index first.
+ */
+LptScheduler::Plan LptScheduler::plan(const std::vector<double>& costs, unsigned int workers,
+                                      const std::vector<std::size_t>& groups,
+                                      const std::vector<unsigned int>& limits) {
+    if (workers == 0) {
+        throw std::invalid_argument("workers must be positive");
+    }
+    if (!groups.empty() && groups.size() != costs.size()) {
+        throw std::invalid_argument("groups must cover every job");
+    }
+
+    Plan result;
+    result.order.resize(costs.size());
+    std::iota(result.order.begin(), result.order.end(), std::size_t(0));
+    // Stable so equal-cost jobs keep their input order.
+    std::stable_sort(result.order.begin(), result.order.end(),
+        [&costs](std::size_t a, std::size_t b) { return costs[a] > costs[b]; });
+
+    auto groupOf = [&groups](std::size_t job) { return groups.empty() ? 0 : groups[job]; };
+    auto limitOf = [&limits](std::size_t group) { return group < limits.size() ? limits[group] : 0u; };
+
+    std::vector<unsigned int> active;
+    for (std::size_t job = 0; job < costs.size(); ++job) {
+        active.resize(std::max(active.size(), groupOf(job) + 1), 0);
+    }
+
+    // Running jobs as (finish time, job); earliest first.
+    using Finish = std::pair<double, std::size_t>;
+    std::priority_queue<Finish, std::vector<Finish>, std::greater<Finish>> running;
+
+    result.worker.resize(costs.size());
+    result.workerLoads.assign(workers, 0.0);
+    std::vector<std::size_t> pending(result.order.begin(), result.order.end());
+    double now = 0.0;
+
+    while (!pending.empty()) {
+        while (!running.empty() && running.top().first <= now) {
+            --active[groupOf(running.top().second)];
+            running.pop();
+        }
+
+        auto worker = std::find_if(result.workerLoads.begin(), result.workerLoads.end(),
+            [now](double load) { return load <= now; });
+        auto next = std::find_if(pending.begin(), pending.end(), [&](std::size_t job) {
+            unsigned int limit = limitOf(groupOf(job));
+            return limit == 0 || active[groupOf(job)] < limit;
+        });
+
+        if (worker != result.workerLoads.end() && next != pending.end()) {
+            std::size_t job = *next;
+            pending.erase(next);
+            ++active[groupOf(job)];
+            result.worker[job] = static_cast<std::size_t>(worker - result.workerLoads.begin());
+            *worker = now + costs[job];
+            running.push(Finish(*worker, job));
+            continue;
+        }
+
+        // No free worker, or every remaining job waits on a saturated group:
+        // nothing changes until the next job finishes.
+        if (running.empty()) {
+            break;
+        }
+        now = running.top().first;
+    }
+
+    result.predictedMakespan = result.workerLoads.empty()
+        ? 0.0
+        : *std::max_element(result.workerLoads.begin(), result.workerLoads.end());
+    return result;
+}
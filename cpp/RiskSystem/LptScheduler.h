@@ -0,0 +1,38 @@
+#ifndef LPTSCHEDULER_H
+#define LPTSCHEDULER_H
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * LptScheduler
+ *
+ * Longest-processing-time-first list scheduling. Jobs are ordered by
+ * descending expected cost and each is given to the worker that would
+ * become free first. The resulting makespan is within 4/3 of optimal,
+ * and running the jobs in this order from a shared queue reproduces the
+ * plan when costs are accurate.
+ *
+ * Jobs can be put in groups with a cap on how many of a group run at once
+ * (an engine's maxConcurrency). The plan then follows BulkheadDispatcher: a
+ * free worker takes the first job in the order whose group has room, and
+ * waits when none has, so the predicted makespan includes the time spent
+ * queueing behind a saturated engine.
+ */
+class LptScheduler {
+public:
+    struct Plan {
+        std::vector<std::size_t> order;     // job indices, longest first
+        std::vector<std::size_t> worker;    // worker assigned to each job index
+        std::vector<double> workerLoads;    // time each worker finishes its last job
+        double predictedMakespan = 0.0;
+    };
+
+    static Plan plan(const std::vector<double>& costs, unsigned int workers);
+
+    // groups[i] is job i's group; limits[g] caps group g (0 or absent: no cap).
+    static Plan plan(const std::vector<double>& costs, unsigned int workers,
+                     const std::vector<std::size_t>& groups, const std::vector<unsigned int>& limits);
+};
+
+#endif // LPTSCHEDULER_H
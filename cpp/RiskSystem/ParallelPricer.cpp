@@ -23,140 +23,232 @@ void ParallelPricer::price(const std::vector<std::vector<ITrade*>>& tradeContain
 */
 
 #include "ParallelPricer.h"
+#include "ShardedResultReceiver.h"
+#include "EngineBatcher.h"
+#include "LptScheduler.h"
+#include "BulkheadDispatcher.h"
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <exception>
 #include <stdexcept>
 #include <future>
-
-// Reuse:
-// Concrete pricing engines already implemented in the system.
-// The same pricing engines are reused here to ensure consistent pricing logic
-// between serial and parallel execution.
-#include "../Pricers/GovBondPricingEngine.h"
-#include "../Pricers/CorpBondPricingEngine.h"
-#include "../Pricers/FxPricingEngine.h"
-
-ParallelPricer::~ParallelPricer() {
-    // Cleanup:
-    // Pricing engines are owned by this class and must be released.
-    for (auto& kv : pricers_) {
-        delete kv.second;
-    }
-    pricers_.clear();
-}
-
-void ParallelPricer::loadPricers() {
-    // Reuse:
-    // Pricing engine configuration is loaded using the same mechanism
-    // as the serial pricer to ensure identical configuration behaviour.
-    pricers_.clear();
-
-    PricingConfigLoader pricingConfigLoader;
-    pricingConfigLoader.setConfigFile("./PricingConfig/PricingEngines.xml");
-    PricingEngineConfig pricerConfig = pricingConfigLoader.loadConfig();
-
-    for (const auto& configItem : pricerConfig) {
-        const std::string& tradeType = configItem.getTradeType();
-        std::string typeName = configItem.getTypeName();
-
-        // Compatibility:
-        // Configuration values may include fully-qualified names.
-        // Only the concrete class name is required for the C++ implementation.
-        auto dotPos = typeName.find_last_of('.');
-        if (dotPos != std::string::npos) {
-            typeName = typeName.substr(dotPos + 1);
+#include <utility>
+#include <span>
+#include <string>
+
+namespace {
+    /*
+     * Gives every trade of a batch whose engine threw an error result, so
+     * the receiver still holds one outcome per trade when the failure is
+     * rethrown to the caller.
+     */
+    void reportFailure(std::span<ITrade* const> trades, const std::exception_ptr& error,
+                       IScalarResultReceiver& receiver) {
+        std::string detail = "Pricing engine failed";
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            detail += ": ";
+            detail += e.what();
+        } catch (...) {
         }
 
-        IPricingEngine* engine = nullptr;
-
-        // Factory mapping:
-        // Map configured engine type to the corresponding C++ implementation.
-        if (typeName == "GovBondPricingEngine") {
-            engine = new GovBondPricingEngine();
-        } else if (typeName == "CorpBondPricingEngine") {
-            engine = new CorpBondPricingEngine();
-        } else if (typeName == "FxPricingEngine") {
-            engine = new FxPricingEngine();
-        } else {
-            throw std::runtime_error(
-                "Unknown pricing engine type: " + configItem.getTypeName());
+        std::vector<ResultRecord> records;
+        records.reserve(trades.size());
+        for (ITrade* trade : trades) {
+            records.push_back(ResultRecord { trade->getTradeIdView(), 0.0, ResultCode::Error, detail });
         }
-
-        // Store pricing engine by trade type for fast lookup during pricing.
-        pricers_[tradeType] = engine;
+        receiver.addResults(records);
     }
 }
 
+ParallelPricer::ParallelPricer(PricingEngineRegistry& registry) : registry_(registry) {
+}
+
 void ParallelPricer::price(
     const std::vector<std::vector<ITrade*>>& tradeContainers,
-    IScalarResultReceiver* resultReceiver) {
+    IScalarResultReceiver* resultReceiver,
+    const CancellationToken& token) {
 
     if (resultReceiver == nullptr) {
         throw std::invalid_argument("resultReceiver cannot be null");
     }
 
-    // Load pricing engines once before starting parallel execution.
-    loadPricers();
+    // Engines are built once per process by the registry and reused here.
+    const auto& pricers = registry_.getPricers();
 
-    // Thread-safe adapter:
-    // Result insertion is protected by a mutex to avoid data races,
-    // while pricing calculations themselves run without locking.
-    class LockedReceiver : public IScalarResultReceiver {
-    public:
-        LockedReceiver(IScalarResultReceiver* inner, std::mutex& m)
-            : inner_(inner), m_(m) {}
+    // Thread-safe collection:
+    // Each pricing thread buffers into its own shard, so threads never wait
+    // on each other. The shards are merged into the caller's receiver once
+    // all tasks have finished.
+    ShardedResultReceiver shardedReceiver;
 
-        void addResult(const std::string& tradeId, double result) override {
-            std::lock_guard<std::mutex> lock(m_);
-            inner_->addResult(tradeId, result);
+    // Batching:
+    // Trades are grouped by engine into batches of at most batchSize_, so
+    // each engine pays its fixed latency once per batch instead of once per
+    // trade. Trades without an engine are reported straight away.
+    EngineBatcher batcher(pricers, batchSize_);
+    for (const auto& tradeContainer : tradeContainers) {
+        for (ITrade* trade : tradeContainer) {
+            if (!batcher.add(trade)) {
+                shardedReceiver.addError(
+                    trade->getTradeId(),
+                    "No Pricing Engines available for this trade type");
+            }
         }
+    }
 
-        void addError(const std::string& tradeId, const std::string& error) override {
-            std::lock_guard<std::mutex> lock(m_);
-            inner_->addError(tradeId, error);
+    // Cost-aware scheduling:
+    // Batches are ordered longest-expected-first (LPT) so the slow engines
+    // start early instead of stretching the tail. Expected cost comes from
+    // each engine's latency model, corrected by what earlier runs observed.
+    // An engine's batches form one group capped at its maxConcurrency, so
+    // the predicted makespan includes the wait at its bulkhead.
+    const auto& batches = batcher.getBatches();
+    const auto& concurrencyLimits = registry_.getConcurrencyLimits();
+    std::vector<double> costs;
+    std::vector<std::size_t> groups;
+    std::vector<unsigned int> limits;
+    std::unordered_map<const IPricingEngine*, std::size_t> groupOf;
+    costs.reserve(batches.size());
+    groups.reserve(batches.size());
+    for (const auto& batch : batches) {
+        costs.push_back(costModel_.expectedCost(batch.engine, batch.trades.size()));
+        auto group = groupOf.emplace(batch.engine, limits.size());
+        if (group.second) {
+            auto limit = concurrencyLimits.find(batch.engine);
+            limits.push_back(limit == concurrencyLimits.end() ? 0 : limit->second);
         }
+        groups.push_back(group.first->second);
+    }
 
-    private:
-        IScalarResultReceiver* inner_;
-        std::mutex& m_;
-    };
-
-    LockedReceiver lockedReceiver(resultReceiver, resultMutex_);
+    ThreadPool& pool = getPool();
+    LptScheduler::Plan plan = LptScheduler::plan(costs, pool.getThreadCount(), groups, limits);
 
     // Parallel execution strategy:
-    // Each trade pricing calculation is launched as an asynchronous task.
-    // Tasks execute in parallel and results are collected once all tasks finish.
-    std::vector<std::future<void>> tasks;
-
-    for (const auto& tradeContainer : tradeContainers) {
-        for (ITrade* trade : tradeContainer) {
-            tasks.push_back(std::async(std::launch::async,
-                [this, trade, &lockedReceiver]() {
-
-                    //const std::string tradeType = trade->getInstrument();
-                    const std::string tradeType = trade->getTradeType();
-
-                    auto it = pricers_.find(tradeType);
-                    if (it == pricers_.end()) {
-                        // Error handling:
-                        // If no pricing engine exists for the trade type,
-                        // record an error instead of pricing.
-                        lockedReceiver.addError(
-                            trade->getTradeId(),
-                            "No Pricing Engines available for this trade type");
-                        return;
-                    }
-
-                    // Pricing:
-                    // Pricing engine execution occurs without locking
-                    // to allow maximum parallelism.
-                    it->second->price(trade, &lockedReceiver);
-                }));
+    // One task per pool worker; each repeatedly takes the next batch in LPT
+    // order, which is greedy list scheduling. Load balancing is this shared
+    // queue, not the pool's work stealing: every worker holds exactly one
+    // task, so there is nothing to steal. Engines with a configured
+    // maxConcurrency are guarded by the dispatcher: a worker skips batches
+    // for a saturated engine and prices another trade type instead.
+    // Pricing engine execution occurs without locking to allow maximum
+    // parallelism, and a failing batch does not stop the others.
+    std::vector<const IPricingEngine*> batchEngines;
+    batchEngines.reserve(batches.size());
+    for (const auto& batch : batches) {
+        batchEngines.push_back(batch.engine);
+    }
+    BulkheadDispatcher dispatcher(std::move(batchEngines), plan.order, registry_.getConcurrencyLimits());
+
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+
+    auto runBatches = [&]() {
+        std::size_t i = 0;
+        while (dispatcher.acquire(i)) {
+            const auto& batch = batches[i];
+            if (token.isCancelled()) {
+                // Past the deadline: drain the remaining batches as timeouts.
+                IPricingEngine::reportTimeouts(batch.trades, &shardedReceiver);
+                dispatcher.release(i);
+                continue;
+            }
+
+            auto started = std::chrono::steady_clock::now();
+            try {
+                batch.engine->priceBatch(batch.trades, &shardedReceiver, token);
+            } catch (...) {
+                dispatcher.release(i);
+                std::exception_ptr error = std::current_exception();
+                reportFailure(batch.trades, error, shardedReceiver);
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failure) {
+                    failure = error;
+                }
+                continue;
+            }
+            dispatcher.release(i);
+
+            // An interrupted batch says nothing about the engine's speed.
+            if (!token.isCancelled()) {
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - started;
+                costModel_.record(batch.engine, batch.trades.size(), elapsed.count());
+            }
         }
+    };
+
+    auto started = std::chrono::steady_clock::now();
+    std::size_t workers = std::min<std::size_t>(pool.getThreadCount(), batches.size());
+    std::vector<std::future<void>> tasks;
+    for (std::size_t w = 0; w < workers; ++w) {
+        tasks.push_back(pool.submit(runBatches));
     }
 
     // Synchronisation point:
     // The function blocks until all pricing tasks have completed,
-    // ensuring all results are available before returning.
+    // ensuring all results are available before returning. Results that
+    // were produced are delivered even if one of the batches failed, and
+    // that batch's trades are reported as errors before the rethrow.
     for (auto& f : tasks) {
         f.get();
     }
+    std::chrono::duration<double, std::milli> makespan = std::chrono::steady_clock::now() - started;
+
+    lastSchedule_.batches = batches.size();
+    lastSchedule_.workers = pool.getThreadCount();
+    lastSchedule_.predictedMakespanMs = plan.predictedMakespan;
+    lastSchedule_.actualMakespanMs = makespan.count();
+
+    shardedReceiver.mergeInto(*resultReceiver);
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+TradeDeltaTracker::Summary ParallelPricer::priceDelta(const std::vector<std::vector<ITrade*>>& tradeContainers,
+                                                      IScalarResultReceiver* resultReceiver,
+                                                      TradeDeltaTracker& tracker,
+                                                      const CancellationToken& token) {
+    return tracker.reprice(tradeContainers, resultReceiver,
+        [&](const std::vector<std::vector<ITrade*>>& changed, IScalarResultReceiver* receiver) {
+            price(changed, receiver, token);
+        }, registry_.getCacheTag());
+}
+
+std::size_t ParallelPricer::getBatchSize() const {
+    return batchSize_;
+}
+
+void ParallelPricer::setBatchSize(std::size_t batchSize) {
+    if (batchSize == 0) {
+        throw std::invalid_argument("batchSize must be positive");
+    }
+    batchSize_ = batchSize;
+}
+
+unsigned int ParallelPricer::getThreadCount() const {
+    return threadCount_;
+}
+
+void ParallelPricer::setThreadCount(unsigned int threadCount) {
+    threadCount_ = threadCount;
+    pool_.reset();
+}
+
+ThreadPool& ParallelPricer::getPool() {
+    if (!pool_) {
+        pool_ = std::make_unique<ThreadPool>(threadCount_);
+    }
+    return *pool_;
+}
+
+const ParallelPricer::ScheduleReport& ParallelPricer::getLastSchedule() const {
+    return lastSchedule_;
+}
+
+const EngineCostModel& ParallelPricer::getCostModel() const {
+    return costModel_;
 }
@@ -4,26 +4,67 @@
 #include "../Models/IPricingEngine.h"
 #include "../Models/ITrade.h"
 #include "../Models/IScalarResultReceiver.h"
-#include "PricingConfigLoader.h"
-#include <map>
+#include "../Models/Symbol.h"
+#include "../Models/CancellationToken.h"
+#include "PricingEngineRegistry.h"
+#include "TradeDeltaTracker.h"
+#include "ThreadPool.h"
+#include "EngineCostModel.h"
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
-#include <thread>
-#include <mutex>
-#include <future>
 
 class ParallelPricer {
+public:
+    // Outcome of the last price() call. Nothing is logged; callers report
+    // it as they see fit (see ScreenResultPrinter::printSchedule).
+    struct ScheduleReport {
+        std::size_t batches = 0;
+        unsigned int workers = 0;
+        double predictedMakespanMs = 0.0;
+        double actualMakespanMs = 0.0;
+    };
+
 private:
-    std::map<std::string, IPricingEngine*> pricers_;
-    std::mutex resultMutex_;
+    PricingEngineRegistry& registry_;
+    std::size_t batchSize_ = 16;
+    unsigned int threadCount_ = 0;
+    std::unique_ptr<ThreadPool> pool_;
+    EngineCostModel costModel_;
+    ScheduleReport lastSchedule_;
     
-    void loadPricers();
+    ThreadPool& getPool();
     
 public:
-    ~ParallelPricer();
+    explicit ParallelPricer(PricingEngineRegistry& registry = PricingEngineRegistry::instance());
     
+    // Once the token fires no further batches are dispatched, batches in
+    // flight are interrupted, and their trades are reported as timed out.
     void price(const std::vector<std::vector<ITrade*>>& tradeContainers, 
-               IScalarResultReceiver* resultReceiver);
+               IScalarResultReceiver* resultReceiver,
+               const CancellationToken& token = CancellationToken());
+
+    // Delta mode: prices only the trades the tracker sees as added or
+    // amended since its last run and carries the other results forward.
+    // The registry's cache tag is the generation token, so a change of model,
+    // market or seed in any engine reprices the whole book.
+    TradeDeltaTracker::Summary priceDelta(const std::vector<std::vector<ITrade*>>& tradeContainers,
+                                          IScalarResultReceiver* resultReceiver,
+                                          TradeDeltaTracker& tracker,
+                                          const CancellationToken& token = CancellationToken());
+
+    // Largest number of trades sent to an engine in one task.
+    std::size_t getBatchSize() const;
+    void setBatchSize(std::size_t batchSize);
+
+    // Worker threads in the pricing pool; 0 uses hardware_concurrency.
+    // The pool is created on first use and kept for later price() calls.
+    unsigned int getThreadCount() const;
+    void setThreadCount(unsigned int threadCount);
+
+    const ScheduleReport& getLastSchedule() const;
+    const EngineCostModel& getCostModel() const;
 };
 
 #endif // PARALLELPRICER_H
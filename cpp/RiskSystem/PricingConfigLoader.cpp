@@ -15,6 +15,7 @@ PricingEngineConfig PricingConfigLoader::loadConfig() {
 
 #include "PricingConfigLoader.h"
 
+#include <climits>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -40,6 +41,9 @@ PricingEngineConfig PricingConfigLoader::loadConfig() {
  *  - The provided XML is flat and predictable:
  *      <PricingEngines>
  *        <Engine tradeType="..." assembly="..." pricingEngine="..." />
+ *        <Engine ... maxConcurrency="2" />   (optional, 0 or absent = unlimited)
+ *        <Engine ... seed="42" />            (optional, absent = random per engine)
+ *        <Engine ... marketData="FxMarket.dat" />   (optional, FX engines)
  *        ...
  *      </PricingEngines>
  *  - For this controlled structure, attribute extraction is sufficient.
@@ -94,11 +98,11 @@ PricingEngineConfig PricingConfigLoader::parseXml(const std::string& content) {
 
         // Small reusable helper: extract attribute values from a single Engine line.
         // If you later build other config loaders, you can reuse the same pattern.
-        auto extractAttr = [&](const std::string& attr) -> std::string {
+        auto findAttr = [&](const std::string& attr, std::string& value) -> bool {
             const std::string key = attr + "=\"";
             auto pos = line.find(key);
             if (pos == std::string::npos) {
-                throw std::runtime_error("Engine element missing attribute: " + attr);
+                return false;
             }
 
             pos += key.size();
@@ -107,7 +111,16 @@ PricingEngineConfig PricingConfigLoader::parseXml(const std::string& content) {
                 throw std::runtime_error("Malformed attribute value for: " + attr);
             }
 
-            return line.substr(pos, end - pos);
+            value = line.substr(pos, end - pos);
+            return true;
+        };
+
+        auto extractAttr = [&](const std::string& attr) -> std::string {
+            std::string value;
+            if (!findAttr(attr, value)) {
+                throw std::runtime_error("Engine element missing attribute: " + attr);
+            }
+            return value;
         };
 
         // Convert XML -> strongly typed config item (separation of concerns).
@@ -118,6 +131,46 @@ PricingEngineConfig PricingConfigLoader::parseXml(const std::string& content) {
         item.setAssembly(extractAttr("assembly"));
         item.setTypeName(extractAttr("pricingEngine"));
 
+        // Optional: cap on concurrent calls into this engine (bulkhead).
+        // Absent means unlimited, matching the behaviour before the attribute existed.
+        std::string maxConcurrency;
+        if (findAttr("maxConcurrency", maxConcurrency)) {
+            std::size_t parsed = 0;
+            unsigned long limit = 0;
+            try {
+                limit = std::stoul(maxConcurrency, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed == 0 || parsed != maxConcurrency.size() || limit > UINT_MAX) {
+                throw std::runtime_error("Malformed attribute value for: maxConcurrency");
+            }
+            item.setMaxConcurrency(static_cast<unsigned int>(limit));
+        }
+
+        // Optional: market data file, loaded by the registry.
+        std::string marketData;
+        if (findAttr("marketData", marketData)) {
+            item.setMarketData(marketData);
+        }
+
+        // Optional: fixed seed, making the engine's results reproducible
+        // from run to run. Applied when the engine is built, never later.
+        std::string seed;
+        if (findAttr("seed", seed)) {
+            std::size_t parsed = 0;
+            unsigned long long value = 0;
+            try {
+                value = std::stoull(seed, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed == 0 || parsed != seed.size() || seed[0] == '-') {
+                throw std::runtime_error("Malformed attribute value for: seed");
+            }
+            item.setSeed(static_cast<std::uint64_t>(value));
+        }
+
         config.push_back(item);
     }
 
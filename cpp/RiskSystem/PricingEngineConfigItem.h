@@ -1,6 +1,8 @@
 #ifndef PRICINGENGINECONFIGITEM_H
 #define PRICINGENGINECONFIGITEM_H
 
+#include <cstdint>
+#include <optional>
 #include <string>
 
 class PricingEngineConfigItem {
@@ -13,11 +15,27 @@ public:
     
     std::string getTypeName() const { return typeName_; }
     void setTypeName(const std::string& typeName) { typeName_ = typeName; }
+
+    // Most calls the engine may run at once; 0 means no limit.
+    unsigned int getMaxConcurrency() const { return maxConcurrency_; }
+    void setMaxConcurrency(unsigned int maxConcurrency) { maxConcurrency_ = maxConcurrency; }
+
+    // Market data file for engines that price off one (FxPricingEngine);
+    // relative paths are relative to the config file. Empty when not set.
+    std::string getMarketData() const { return marketData_; }
+    void setMarketData(const std::string& marketData) { marketData_ = marketData; }
+
+    // Fixed seed for the engine's results; unset keeps the engine's own.
+    std::optional<std::uint64_t> getSeed() const { return seed_; }
+    void setSeed(std::uint64_t seed) { seed_ = seed; }
     
 private:
     std::string tradeType_;
     std::string assembly_;
     std::string typeName_;
+    unsigned int maxConcurrency_ = 0;
+    std::string marketData_;
+    std::optional<std::uint64_t> seed_;
 };
 
 #endif // PRICINGENGINECONFIGITEM_H
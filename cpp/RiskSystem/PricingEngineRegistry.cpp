@@ -0,0 +1,102 @@
+#include "PricingEngineRegistry.h"
+#include "PricingConfigLoader.h"
+#include "../Pricers/PricingEngineFactory.h"
+#include "../Pricers/BasePricingEngine.h"
+#include "../Pricers/CachingPricingEngine.h"
+#include "../Pricers/FxPricingEngine.h"
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+PricingEngineRegistry& PricingEngineRegistry::instance() {
+    static PricingEngineRegistry registry(DefaultConfigFile);
+    return registry;
+}
+
+PricingEngineRegistry::PricingEngineRegistry(std::string configFile, PricingResultCache* resultCache)
+    : configFile_(std::move(configFile)), resultCache_(resultCache) {
+}
+
+// call_once retries on the next call if loading throws, so a missing config
+// file is reported every time rather than leaving an empty registry behind.
+void PricingEngineRegistry::load() {
+    std::call_once(loaded_, [this]() {
+        PricingConfigLoader loader;
+        loader.setConfigFile(configFile_);
+        PricingEngineConfig config = loader.loadConfig();
+
+        std::vector<std::unique_ptr<IPricingEngine>> engines;
+        std::unordered_map<Symbol, IPricingEngine*> pricers;
+        std::unordered_map<const IPricingEngine*, unsigned int> limits;
+        std::unordered_map<std::string, std::shared_ptr<FxCurveCache>> markets;
+        const std::filesystem::path configDir = std::filesystem::path(configFile_).parent_path();
+
+        // One engine per config item, so a per-engine limit is a per-trade-type limit.
+        for (const auto& item : config) {
+            engines.push_back(PricingEngineFactory::instance().create(item.getTypeName()));
+            IPricingEngine* engine = engines.back().get();
+            // Seeded here, before the engine is shared, so pricing never reseeds it.
+            if (item.getSeed()) {
+                if (auto* base = dynamic_cast<BasePricingEngine*>(engine)) {
+                    base->setSeed(*item.getSeed());
+                }
+            }
+            if (!item.getMarketData().empty()) {
+                auto* fx = dynamic_cast<FxPricingEngine*>(engine);
+                if (fx == nullptr) {
+                    throw std::runtime_error("marketData is not supported by " + item.getTypeName());
+                }
+                std::string file = (configDir / item.getMarketData()).string();
+                auto& market = markets[file];
+                if (!market) {
+                    market = FxCurveCache::load(file);
+                }
+                fx->setCurveCache(market);
+            }
+            if (resultCache_ != nullptr) {
+                engines.push_back(std::make_unique<CachingPricingEngine>(*engine, item.getTypeName(), *resultCache_));
+                engine = engines.back().get();
+            }
+            pricers[Symbol(item.getTradeType())] = engine;
+            if (item.getMaxConcurrency() != 0) {
+                limits[engine] = item.getMaxConcurrency();
+            }
+        }
+
+        config_ = std::move(config);
+        engines_ = std::move(engines);
+        pricers_ = std::move(pricers);
+        concurrencyLimits_ = std::move(limits);
+    });
+}
+
+const std::unordered_map<Symbol, IPricingEngine*>& PricingEngineRegistry::getPricers() {
+    load();
+    return pricers_;
+}
+
+const std::unordered_map<const IPricingEngine*, unsigned int>& PricingEngineRegistry::getConcurrencyLimits() {
+    load();
+    return concurrencyLimits_;
+}
+
+std::string PricingEngineRegistry::getCacheTag() {
+    load();
+    std::string tag;
+    for (const auto& item : config_) {
+        tag += item.getTradeType();
+        tag += '=';
+        tag += pricers_.at(Symbol(item.getTradeType()))->getCacheTag();
+        tag += '\n';
+    }
+    return tag;
+}
+
+const PricingEngineConfig& PricingEngineRegistry::getConfig() {
+    load();
+    return config_;
+}
+
+const std::string& PricingEngineRegistry::getConfigFile() const {
+    return configFile_;
+}
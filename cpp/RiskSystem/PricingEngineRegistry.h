@@ -0,0 +1,76 @@
+#ifndef PRICINGENGINEREGISTRY_H
+#define PRICINGENGINEREGISTRY_H
+
+#include "../Models/IPricingEngine.h"
+#include "../Models/Symbol.h"
+#include "PricingEngineConfig.h"
+#include "../Pricers/PricingResultCache.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * PricingEngineRegistry
+ *
+ * Owns the pricing engines described by a PricingEngines.xml file. The file
+ * is read, and one engine per Engine element created through
+ * PricingEngineFactory, the first time any accessor is called; after that
+ * the same instances are handed out for the life of the registry.
+ *
+ * instance() is the process-wide registry for the default config file and
+ * is what SerialPricer, ParallelPricer and StreamingTradeLoader use, so
+ * repeated pricing runs in one process pay no setup cost. Engines are shared
+ * between all of them (see IPricingEngine on concurrent use).
+ *
+ * An Engine element's optional seed and marketData are applied as the
+ * engine is built; engines are not reconfigured once handed out. Engines
+ * naming the same market file share one FxCurveCache, so FxSpot and FxFwd
+ * build each curve and forward once between them.
+ *
+ * Given a PricingResultCache, every engine is wrapped in a
+ * CachingPricingEngine tagged with its configured pricingEngine name (and,
+ * through the engine, its model version, market snapshot and seed), so
+ * unchanged trades are answered from the cache on later runs. Caching is
+ * opt-in: instance() has no cache, and a caller that wants one builds its
+ * own registry with it.
+ */
+class PricingEngineRegistry {
+public:
+    static constexpr const char* DefaultConfigFile = "./PricingConfig/PricingEngines.xml";
+
+    static PricingEngineRegistry& instance();
+
+    // The cache, if any, is not owned and must outlive the registry.
+    explicit PricingEngineRegistry(std::string configFile, PricingResultCache* resultCache = nullptr);
+
+    // Engine registered for each configured trade type.
+    const std::unordered_map<Symbol, IPricingEngine*>& getPricers();
+
+    // maxConcurrency of every engine that has one configured.
+    const std::unordered_map<const IPricingEngine*, unsigned int>& getConcurrencyLimits();
+
+    // Every engine's getCacheTag(), in config order: changes whenever any
+    // engine's model, market or seed does.
+    std::string getCacheTag();
+
+    const PricingEngineConfig& getConfig();
+    const std::string& getConfigFile() const;
+
+    PricingEngineRegistry(const PricingEngineRegistry&) = delete;
+    PricingEngineRegistry& operator=(const PricingEngineRegistry&) = delete;
+
+private:
+    void load();
+
+    std::string configFile_;
+    PricingResultCache* resultCache_;
+    std::once_flag loaded_;
+    PricingEngineConfig config_;
+    std::vector<std::unique_ptr<IPricingEngine>> engines_;
+    std::unordered_map<Symbol, IPricingEngine*> pricers_;
+    std::unordered_map<const IPricingEngine*, unsigned int> concurrencyLimits_;
+};
+
+#endif // PRICINGENGINEREGISTRY_H
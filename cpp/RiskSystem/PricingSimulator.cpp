@@ -0,0 +1,367 @@
+#include "PricingSimulator.h"
+#include "EngineCostModel.h"
+#include "LptScheduler.h"
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    // Same grouping rules as EngineBatcher, over trade types instead of trades.
+    class BatchGrouper {
+    public:
+        struct Batch {
+            IPricingEngine* engine;
+            std::size_t trades;
+        };
+
+        BatchGrouper(const std::unordered_map<Symbol, IPricingEngine*>& pricers, std::size_t maxBatchSize)
+            : pricers_(pricers), maxBatchSize_(maxBatchSize) {}
+
+        bool add(Symbol tradeType) {
+            auto it = pricers_.find(tradeType);
+            if (it == pricers_.end()) {
+                return false;
+            }
+            auto open = open_.find(it->second);
+            if (open == open_.end() || (maxBatchSize_ != 0 && batches_[open->second].trades >= maxBatchSize_)) {
+                batches_.push_back(Batch { it->second, 0 });
+                open = open_.insert_or_assign(it->second, batches_.size() - 1).first;
+            }
+            ++batches_[open->second].trades;
+            return true;
+        }
+
+        const std::vector<Batch>& getBatches() const { return batches_; }
+
+    private:
+        const std::unordered_map<Symbol, IPricingEngine*>& pricers_;
+        std::size_t maxBatchSize_;
+        std::vector<Batch> batches_;
+        std::unordered_map<IPricingEngine*, std::size_t> open_;
+    };
+
+    // Min-heap entry; seq keeps events at the same instant in creation order.
+    struct Event {
+        double time;
+        std::size_t seq;
+        int kind;
+        std::size_t id;
+
+        bool operator>(const Event& other) const {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+
+    using EventQueue = std::priority_queue<Event, std::vector<Event>, std::greater<Event>>;
+
+    std::size_t countTrades(const PricingSimulator::Sources& sources) {
+        std::size_t total = 0;
+        for (const auto& source : sources) {
+            total += source.size();
+        }
+        return total;
+    }
+}
+
+PricingSimulator::PricingSimulator(PricingEngineRegistry& registry) : registry_(registry) {
+}
+
+PricingSimulator::Report PricingSimulator::simulateSerial(const Sources& sources) {
+    EngineCostModel costModel;
+    BatchGrouper grouper(registry_.getPricers(), 0);
+    std::size_t unpriced = 0;
+    for (const auto& source : sources) {
+        for (Symbol tradeType : source) {
+            if (!grouper.add(tradeType)) {
+                ++unpriced;
+            }
+        }
+    }
+
+    std::vector<Run> runs;
+    double now = 0.0;
+    for (const auto& batch : grouper.getBatches()) {
+        double cost = costModel.expectedCost(batch.engine, batch.trades);
+        runs.push_back(Run { batch.engine, batch.trades, 0.0, now, now + cost });
+        now += cost;
+    }
+
+    Report report = summarize("serial", runs, 1, now);
+    report.trades = countTrades(sources);
+    report.unpriced = unpriced;
+    return report;
+}
+
+/*
+ * Workers take batches in LPT order; a batch whose engine is at its
+ * maxConcurrency is passed over for the next one that can run, as in
+ * BulkheadDispatcher. Pending batches are kept in one FIFO per engine, so
+ * picking the next batch costs one look per engine rather than a scan of
+ * everything still pending.
+ */
+PricingSimulator::Report PricingSimulator::simulateParallel(const Sources& sources, unsigned int workers,
+                                                            std::size_t batchSize) {
+    if (workers == 0 || batchSize == 0) {
+        throw std::invalid_argument("workers and batchSize must be positive");
+    }
+
+    EngineCostModel costModel;
+    BatchGrouper grouper(registry_.getPricers(), batchSize);
+    std::size_t unpriced = 0;
+    for (const auto& source : sources) {
+        for (Symbol tradeType : source) {
+            if (!grouper.add(tradeType)) {
+                ++unpriced;
+            }
+        }
+    }
+
+    const auto& batches = grouper.getBatches();
+    std::vector<double> costs;
+    costs.reserve(batches.size());
+    for (const auto& batch : batches) {
+        costs.push_back(costModel.expectedCost(batch.engine, batch.trades));
+    }
+    LptScheduler::Plan plan = LptScheduler::plan(costs, workers);
+
+    struct Lane {
+        std::deque<std::size_t> pending;    // positions in plan.order
+        unsigned int active = 0;
+        unsigned int limit = 0;
+    };
+    std::map<IPricingEngine*, Lane> lanes;
+    const auto& limits = registry_.getConcurrencyLimits();
+    for (std::size_t pos = 0; pos < plan.order.size(); ++pos) {
+        IPricingEngine* engine = batches[plan.order[pos]].engine;
+        Lane& lane = lanes[engine];
+        auto limit = limits.find(engine);
+        lane.limit = limit == limits.end() ? 0 : limit->second;
+        lane.pending.push_back(pos);
+    }
+
+    std::vector<Run> runs;
+    runs.reserve(batches.size());
+    EventQueue events;
+    std::size_t seq = 0;
+    unsigned int idle = workers;
+    double now = 0.0;
+
+    for (;;) {
+        while (idle > 0) {
+            Lane* best = nullptr;
+            for (auto& kv : lanes) {
+                Lane& lane = kv.second;
+                if (lane.pending.empty() || (lane.limit != 0 && lane.active >= lane.limit)) {
+                    continue;
+                }
+                if (best == nullptr || lane.pending.front() < best->pending.front()) {
+                    best = &lane;
+                }
+            }
+            if (best == nullptr) {
+                break;
+            }
+
+            std::size_t index = plan.order[best->pending.front()];
+            best->pending.pop_front();
+            ++best->active;
+            --idle;
+            runs.push_back(Run { batches[index].engine, batches[index].trades, 0.0, now, now + costs[index] });
+            events.push(Event { now + costs[index], seq++, 0, index });
+        }
+
+        if (events.empty()) {
+            break;
+        }
+        Event done = events.top();
+        events.pop();
+        now = done.time;
+        --lanes[batches[done.id].engine].active;
+        ++idle;
+    }
+
+    Report report = summarize("parallel", runs, workers, now);
+    report.trades = countTrades(sources);
+    report.unpriced = unpriced;
+    return report;
+}
+
+/*
+ * Mirrors StreamingTradeLoader::loadAndPrice: each source has a loader that
+ * reads batchSize trades at loadMsPerTrade each and pushes the chunk onto a
+ * queue of queueCapacity chunks, blocking while it is full. Each pricing
+ * thread pops a chunk and prices it one engine group after another.
+ */
+PricingSimulator::Report PricingSimulator::simulateStreaming(const Sources& sources, unsigned int pricingThreads,
+                                                             std::size_t batchSize, std::size_t queueCapacity,
+                                                             double loadMsPerTrade) {
+    if (pricingThreads == 0 || batchSize == 0 || queueCapacity == 0) {
+        throw std::invalid_argument("pricingThreads, batchSize and queueCapacity must be positive");
+    }
+    if (loadMsPerTrade < 0.0) {
+        throw std::invalid_argument("loadMsPerTrade cannot be negative");
+    }
+
+    enum Kind { Loaded = 0, Priced = 1 };
+
+    struct Chunk {
+        std::size_t source;
+        std::size_t begin;
+        std::size_t end;
+        double ready;
+    };
+
+    EngineCostModel costModel;
+    const auto& pricers = registry_.getPricers();
+    std::vector<std::size_t> nextTrade(sources.size(), 0);
+    std::vector<Chunk> loading(sources.size());
+    std::deque<Chunk> queue;
+    std::deque<std::size_t> blockedLoaders;
+    std::vector<Run> runs;
+    std::size_t unpriced = 0;
+
+    EventQueue events;
+    std::size_t seq = 0;
+    unsigned int idle = pricingThreads;
+    double now = 0.0;
+
+    auto startLoad = [&](std::size_t source) {
+        std::size_t begin = nextTrade[source];
+        if (begin >= sources[source].size()) {
+            return;
+        }
+        std::size_t end = std::min(begin + batchSize, sources[source].size());
+        nextTrade[source] = end;
+        loading[source] = Chunk { source, begin, end, 0.0 };
+        events.push(Event { now + static_cast<double>(end - begin) * loadMsPerTrade, seq++, Loaded, source });
+    };
+
+    auto price = [&](const Chunk& chunk) {
+        BatchGrouper grouper(pricers, 0);
+        for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+            if (!grouper.add(sources[chunk.source][i])) {
+                ++unpriced;
+            }
+        }
+        double t = now;
+        for (const auto& batch : grouper.getBatches()) {
+            double cost = costModel.expectedCost(batch.engine, batch.trades);
+            runs.push_back(Run { batch.engine, batch.trades, chunk.ready, t, t + cost });
+            t += cost;
+        }
+        events.push(Event { t, seq++, Priced, 0 });
+    };
+
+    for (std::size_t source = 0; source < sources.size(); ++source) {
+        startLoad(source);
+    }
+
+    while (!events.empty()) {
+        Event event = events.top();
+        events.pop();
+        now = event.time;
+
+        if (event.kind == Loaded) {
+            loading[event.id].ready = now;
+            if (queue.size() < queueCapacity) {
+                queue.push_back(loading[event.id]);
+                startLoad(event.id);
+            } else {
+                blockedLoaders.push_back(event.id);
+            }
+        } else {
+            ++idle;
+        }
+
+        while (idle > 0 && !queue.empty()) {
+            Chunk chunk = queue.front();
+            queue.pop_front();
+            --idle;
+
+            // A freed slot lets the longest-blocked loader push and carry on.
+            if (!blockedLoaders.empty()) {
+                std::size_t source = blockedLoaders.front();
+                blockedLoaders.pop_front();
+                queue.push_back(loading[source]);
+                startLoad(source);
+            }
+            price(chunk);
+        }
+    }
+
+    Report report = summarize("streaming", runs, pricingThreads, now);
+    report.trades = countTrades(sources);
+    report.unpriced = unpriced;
+    return report;
+}
+
+PricingSimulator::Report PricingSimulator::summarize(const std::string& mode, const std::vector<Run>& runs,
+                                                     unsigned int workers, double makespan) const {
+    Report report;
+    report.mode = mode;
+    report.batches = runs.size();
+    report.workers = workers;
+    report.makespanMs = makespan;
+
+    std::unordered_map<const IPricingEngine*, std::vector<std::string>> typesByEngine;
+    for (const auto& kv : registry_.getPricers()) {
+        typesByEngine[kv.second].push_back(kv.first.str());
+    }
+
+    std::map<const IPricingEngine*, std::vector<const Run*>> byEngine;
+    double totalDelay = 0.0;
+    for (const Run& run : runs) {
+        byEngine[run.engine].push_back(&run);
+        double delay = run.start - run.ready;
+        totalDelay += delay;
+        report.maxQueueDelayMs = std::max(report.maxQueueDelayMs, delay);
+    }
+    if (!runs.empty()) {
+        report.meanQueueDelayMs = totalDelay / static_cast<double>(runs.size());
+    }
+
+    for (auto& kv : byEngine) {
+        EngineStats stats;
+        std::vector<std::string> types = typesByEngine[kv.first];
+        std::sort(types.begin(), types.end());
+        for (const auto& type : types) {
+            stats.label += (stats.label.empty() ? "" : "/") + type;
+        }
+
+        std::vector<std::pair<double, double>> intervals;
+        double delay = 0.0;
+        for (const Run* run : kv.second) {
+            ++stats.batches;
+            stats.trades += run->trades;
+            stats.busyMs += run->end - run->start;
+            delay += run->start - run->ready;
+            stats.maxQueueDelayMs = std::max(stats.maxQueueDelayMs, run->start - run->ready);
+            intervals.emplace_back(run->start, run->end);
+        }
+        stats.meanQueueDelayMs = delay / static_cast<double>(kv.second.size());
+
+        // Time with at least one batch in flight: length of the interval union.
+        std::sort(intervals.begin(), intervals.end());
+        double covered = 0.0;
+        double openStart = intervals.front().first;
+        double openEnd = intervals.front().second;
+        for (const auto& interval : intervals) {
+            if (interval.first > openEnd) {
+                covered += openEnd - openStart;
+                openStart = interval.first;
+            }
+            openEnd = std::max(openEnd, interval.second);
+        }
+        covered += openEnd - openStart;
+        stats.utilization = makespan > 0.0 ? covered / makespan : 0.0;
+
+        report.engines.push_back(std::move(stats));
+    }
+
+    std::sort(report.engines.begin(), report.engines.end(),
+        [](const EngineStats& a, const EngineStats& b) { return a.label < b.label; });
+    return report;
+}
@@ -1,5 +1,6 @@
 #include "ScreenResultPrinter.h"
 #include <iostream>
+#include <sstream>
 
 /*void ScreenResultPrinter::printResults(ScalarResults& results) {
     for (const auto& result : results) {
@@ -15,31 +16,78 @@
 
 void ScreenResultPrinter::printResults(ScalarResults& results) {
 
-    // Reuse:
-    // ScalarResults already implements iteration (Exercise 5),
-    // so we can directly use a range-for loop.
-    for (const auto& result : results) {
+    // Sorted by trade id so the output does not depend on the order in
+    // which the (possibly parallel) pricers reported their results.
+    for (const auto& result : results.sorted()) {
 
         // Reuse:
         // ScalarResult already exposes the trade identifier.
         // Always print the TradeId first.
-        std::cout << result.getTradeId();
+        out_ << result.getTradeId();
 
         // Reuse:
         // ScalarResult stores the pricing result as std::optional<double>.
         // Only print it if a result exists.
         if (result.getResult().has_value()) {
-            std::cout << " : " << result.getResult().value();
+            out_ << " : " << result.getResult().value();
         }
 
         // Reuse:
         // ScalarResult stores errors as std::optional<std::string>.
         // Only print it if an error exists.
         if (result.getError().has_value()) {
-            std::cout << " : " << result.getError().value();
+            out_ << " : " << result.getError().value();
         }
 
         // One output line per trade, as required by the exercise.
-        std::cout << std::endl;
+        out_ << std::endl;
+    }
+}
+
+void ScreenResultPrinter::addResult(const std::string& tradeId, double result) {
+    out_ << tradeId << " : " << result << std::endl;
+}
+
+void ScreenResultPrinter::addError(const std::string& tradeId, const std::string& error) {
+    out_ << tradeId << " : " << error << std::endl;
+}
+
+/*
+ * Same "TradeID : Result : Error" layout as printResults, one line per
+ * record. Values are formatted with the stream's own settings so the batch
+ * and single-result paths print identically.
+ */
+void ScreenResultPrinter::addResults(std::span<const ResultRecord> records) {
+    std::ostringstream value;
+    value.copyfmt(out_);
+
+    buffer_.clear();
+    for (const ResultRecord& record : records) {
+        buffer_.append(record.tradeId);
+        if (record.hasValue()) {
+            value.str(std::string());
+            value << record.value;
+            buffer_.append(" : ");
+            buffer_.append(value.str());
+        }
+        if (record.hasError()) {
+            buffer_.append(" : ");
+            buffer_.append(record.error());
+        }
+        buffer_.push_back('\n');
     }
+
+    out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    out_.flush();
+}
+
+void ScreenResultPrinter::printSchedule(const ParallelPricer::ScheduleReport& report) {
+    out_ << "Priced " << report.batches << " batches on " << report.workers
+         << " workers: predicted makespan " << report.predictedMakespanMs
+         << " ms, actual " << report.actualMakespanMs << " ms" << std::endl;
+}
+
+void ScreenResultPrinter::printDeltaSummary(const TradeDeltaTracker::Summary& summary) {
+    out_ << "Delta run: " << summary.added << " added, " << summary.amended << " amended, "
+         << summary.unchanged << " unchanged, " << summary.removed << " removed" << std::endl;
 }
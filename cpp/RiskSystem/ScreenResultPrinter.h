@@ -1,11 +1,37 @@
 #ifndef SCREENRESULTPRINTER_H
 #define SCREENRESULTPRINTER_H
 
+#include "../Models/IScalarResultReceiver.h"
 #include "../Models/ScalarResults.h"
+#include "ParallelPricer.h"
+#include <iostream>
+#include <ostream>
+#include <span>
+#include <string>
 
-class ScreenResultPrinter {
+/*
+ * ScreenResultPrinter
+ *
+ * Prints a finished ScalarResults, or acts as a receiver that prints results
+ * as they arrive. A batch is formatted into one buffer and written with a
+ * single stream call. Also prints the run summaries the pricers keep rather
+ * than log themselves.
+ */
+class ScreenResultPrinter : public IScalarResultReceiver {
 public:
+    explicit ScreenResultPrinter(std::ostream& out = std::cout) : out_(out) {}
+
     void printResults(ScalarResults& results);
+    void printSchedule(const ParallelPricer::ScheduleReport& report);
+    void printDeltaSummary(const TradeDeltaTracker::Summary& summary);
+
+    void addResult(const std::string& tradeId, double result) override;
+    void addError(const std::string& tradeId, const std::string& error) override;
+    void addResults(std::span<const ResultRecord> records) override;
+
+private:
+    std::ostream& out_;
+    std::string buffer_;
 };
 
 #endif // SCREENRESULTPRINTER_H
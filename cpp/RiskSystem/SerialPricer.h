@@ -4,20 +4,34 @@
 #include "../Models/IPricingEngine.h"
 #include "../Models/ITrade.h"
 #include "../Models/IScalarResultReceiver.h"
-#include "PricingConfigLoader.h"
-#include <map>
+#include "../Models/Symbol.h"
+#include "../Models/CancellationToken.h"
+#include "PricingEngineRegistry.h"
+#include "TradeDeltaTracker.h"
 #include <vector>
 #include <string>
 
 class SerialPricer {
 private:
-    std::map<std::string, IPricingEngine*> pricers_;
-    void loadPricers();
+    PricingEngineRegistry& registry_;
     
 public:
-    ~SerialPricer();
+    explicit SerialPricer(PricingEngineRegistry& registry = PricingEngineRegistry::instance());
+
+    // Engine batches not started before the token fires are reported as
+    // timed out, and a batch in flight is interrupted.
     void price(const std::vector<std::vector<ITrade*>>& tradeContainers, 
-               IScalarResultReceiver* resultReceiver);
+               IScalarResultReceiver* resultReceiver,
+               const CancellationToken& token = CancellationToken());
+
+    // Delta mode: prices only the trades the tracker sees as added or
+    // amended since its last run and carries the other results forward.
+    // The registry's cache tag is the generation token, so a change of model,
+    // market or seed in any engine reprices the whole book.
+    TradeDeltaTracker::Summary priceDelta(const std::vector<std::vector<ITrade*>>& tradeContainers,
+                                          IScalarResultReceiver* resultReceiver,
+                                          TradeDeltaTracker& tracker,
+                                          const CancellationToken& token = CancellationToken());
 };
 
 #endif // SERIALPRICER_H
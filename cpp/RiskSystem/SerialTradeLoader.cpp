@@ -1,17 +1,25 @@
 #include "SerialTradeLoader.h"
 #include "../Loaders/BondTradeLoader.h"
 #include "../Loaders/FxTradeLoader.h"
+#include "../Loaders/SnapshotTradeLoader.h"
+#include <memory>
 
+/*
+ * Each text loader is wrapped in a SnapshotTradeLoader so that reruns over
+ * unchanged files read the binary snapshot instead of re-parsing the text.
+ */
 std::vector<ITradeLoader*> SerialTradeLoader::getTradeLoaders() {
     std::vector<ITradeLoader*> loaders;
     
-    BondTradeLoader* bondLoader = new BondTradeLoader();
+    auto bondLoader = std::make_unique<BondTradeLoader>();
     bondLoader->setDataFile("TradeData/BondTrades.dat");
-    loaders.push_back(bondLoader);
+    bondLoader->setMemoryMapped(true);
+    loaders.push_back(new SnapshotTradeLoader(std::move(bondLoader)));
     
-    FxTradeLoader* fxLoader = new FxTradeLoader();
+    auto fxLoader = std::make_unique<FxTradeLoader>();
     fxLoader->setDataFile("TradeData/FxTrades.dat");
-    loaders.push_back(fxLoader);
+    fxLoader->setParallel(true);
+    loaders.push_back(new SnapshotTradeLoader(std::move(fxLoader)));
     
     return loaders;
 }
@@ -22,8 +30,33 @@ std::vector<std::vector<ITrade*>> SerialTradeLoader::loadTrades() {
     
     for (auto loader : loaders) {
         result.push_back(loader->loadTrades());
+        delete loader;
     }
     
     return result;
 }
 
+void SerialTradeLoader::loadTrades(TradeBook& book) {
+    static constexpr std::size_t BatchSize = 1024;
+
+    auto loaders = getTradeLoaders();
+    std::vector<ITrade*> batch;
+    try {
+        for (auto loader : loaders) {
+            auto cursor = loader->openCursor();
+            while (cursor->nextBatch(batch, BatchSize) != 0) {
+                for (ITrade* trade : batch) {
+                    book.add(*trade);
+                }
+                for (ITrade* trade : batch) delete trade;
+                batch.clear();
+            }
+        }
+    } catch (...) {
+        for (ITrade* trade : batch) delete trade;
+        for (auto loader : loaders) delete loader;
+        throw;
+    }
+
+    for (auto loader : loaders) delete loader;
+}
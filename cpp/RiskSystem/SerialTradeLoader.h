@@ -3,6 +3,7 @@
 
 #include "../Loaders/ITradeLoader.h"
 #include "../Models/ITrade.h"
+#include "../Models/TradeBook.h"
 #include <vector>
 
 class SerialTradeLoader {
@@ -11,6 +12,9 @@ private:
     
 public:
     std::vector<std::vector<ITrade*>> loadTrades();
+
+    // Streams every loader into the book; no per-trade objects are retained.
+    void loadTrades(TradeBook& book);
 };
 
 #endif // SERIALTRADELOADER_H
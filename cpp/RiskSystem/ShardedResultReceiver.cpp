@@ -0,0 +1,87 @@
+#include "ShardedResultReceiver.h"
+#include <atomic>
+
+namespace {
+    // Receivers may be created at a reused address, so the thread-local
+    // cache is keyed by a process-unique id instead of by pointer.
+    std::atomic<std::uint64_t> nextReceiverId { 1 };
+
+    struct ShardCache {
+        std::uint64_t ownerId = 0;
+        void* shard = nullptr;
+    };
+
+    thread_local ShardCache cache;
+}
+
+ShardedResultReceiver::ShardedResultReceiver() : id_(nextReceiverId.fetch_add(1)) {
+}
+
+ShardedResultReceiver::~ShardedResultReceiver() = default;
+
+/*
+ * localShard
+ *
+ * Fast path is a thread-local compare. The registry mutex is only taken the
+ * first time a thread reports to this receiver (or after it reported to a
+ * different receiver in between).
+ */
+ShardedResultReceiver::Shard& ShardedResultReceiver::localShard() {
+    if (cache.ownerId == id_) {
+        return *static_cast<Shard*>(cache.shard);
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    auto& shard = shards_[std::this_thread::get_id()];
+    if (!shard) {
+        shard = std::make_unique<Shard>();
+    }
+    cache.ownerId = id_;
+    cache.shard = shard.get();
+    return *shard;
+}
+
+void ShardedResultReceiver::addResult(const std::string& tradeId, double result) {
+    Shard& shard = localShard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.results.addResult(tradeId, result);
+}
+
+void ShardedResultReceiver::addError(const std::string& tradeId, const std::string& error) {
+    Shard& shard = localShard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.results.addError(tradeId, error);
+}
+
+void ShardedResultReceiver::addResults(std::span<const ResultRecord> records) {
+    Shard& shard = localShard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.results.addResults(records);
+}
+
+void ShardedResultReceiver::mergeInto(IScalarResultReceiver& target) {
+    std::vector<Shard*> shards;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        shards.reserve(shards_.size());
+        for (auto& kv : shards_) {
+            shards.push_back(kv.second.get());
+        }
+    }
+
+    // Swap each buffer out under its own lock so producers are blocked only
+    // for the swap, not while the target is being filled.
+    ResultBatch drained;
+    for (Shard* shard : shards) {
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            drained.swap(shard->results);
+        }
+        drained.flushTo(target);
+    }
+}
+
+std::size_t ShardedResultReceiver::getShardCount() const {
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    return shards_.size();
+}
@@ -0,0 +1,60 @@
+#ifndef SHARDEDRESULTRECEIVER_H
+#define SHARDEDRESULTRECEIVER_H
+
+#include "../Models/IScalarResultReceiver.h"
+#include "../Models/ResultBatch.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ShardedResultReceiver
+ *
+ * Concurrent IScalarResultReceiver for the parallel pricers. Every producing
+ * thread appends to its own shard, so pricing threads never contend with
+ * each other. Each shard has a mutex, but only the owning thread and
+ * mergeInto() ever take it, so on the hot path it is always uncontended.
+ *
+ * mergeInto() drains every shard into a target receiver with one
+ * addResults call per shard, preserving the order in which each thread
+ * reported its results. It can be called at the end of a run or at any
+ * point by a reader that wants what has arrived so far; entries are
+ * delivered exactly once.
+ */
+class ShardedResultReceiver : public IScalarResultReceiver {
+public:
+    ShardedResultReceiver();
+    ~ShardedResultReceiver() override;
+
+    ShardedResultReceiver(const ShardedResultReceiver&) = delete;
+    ShardedResultReceiver& operator=(const ShardedResultReceiver&) = delete;
+
+    void addResult(const std::string& tradeId, double result) override;
+    void addError(const std::string& tradeId, const std::string& error) override;
+    void addResults(std::span<const ResultRecord> records) override;
+
+    void mergeInto(IScalarResultReceiver& target);
+
+    // Number of threads that have reported at least once.
+    std::size_t getShardCount() const;
+
+private:
+    // Cache-line aligned so neighbouring shards do not false-share.
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        ResultBatch results;
+    };
+
+    Shard& localShard();
+
+    const std::uint64_t id_;
+    mutable std::mutex registryMutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<Shard>> shards_;
+};
+
+#endif // SHARDEDRESULTRECEIVER_H
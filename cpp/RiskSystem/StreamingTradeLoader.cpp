@@ -1,44 +1,17 @@
 #include "StreamingTradeLoader.h"
 #include "../Loaders/BondTradeLoader.h"
 #include "../Loaders/FxTradeLoader.h"
-#include "PricingConfigLoader.h"
+#include "../Loaders/ITradeFollower.h"
+#include "../Models/ResultBatch.h"
+#include "EngineBatcher.h"
+#include "BoundedQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <stdexcept>
 
-#include "../Pricers/GovBondPricingEngine.h"
-#include "../Pricers/CorpBondPricingEngine.h"
-#include "../Pricers/FxPricingEngine.h"
-
-#include <iostream>   // ✅ REQUIRED for std::cout / std::endl
-
-
-/*std::vector<ITradeLoader*> StreamingTradeLoader::getTradeLoaders() {
-    std::vector<ITradeLoader*> loaders;
-    
-    BondTradeLoader* bondLoader = new BondTradeLoader();
-    bondLoader->setDataFile("TradeData/BondTrades.dat");
-    loaders.push_back(bondLoader);
-    
-    FxTradeLoader* fxLoader = new FxTradeLoader();
-    fxLoader->setDataFile("TradeData/FxTrades.dat");
-    loaders.push_back(fxLoader);
-    
-    return loaders;
-}
-
-void StreamingTradeLoader::loadPricers() {
-    throw std::runtime_error("Not implemented");
-}
-
-StreamingTradeLoader::~StreamingTradeLoader() {
-    
-}
-
-void StreamingTradeLoader::loadAndPrice(IScalarResultReceiver* resultReceiver) {
-    throw std::runtime_error("Not implemented");
-}
-*/
-
-
 /*
  * Reuse:
  * We reuse the existing trade loaders exactly as they are.
@@ -49,6 +22,7 @@ std::vector<ITradeLoader*> StreamingTradeLoader::getTradeLoaders() {
 
     BondTradeLoader* bondLoader = new BondTradeLoader();
     bondLoader->setDataFile("TradeData/BondTrades.dat");
+    bondLoader->setMemoryMapped(true);
     loaders.push_back(bondLoader);
 
     FxTradeLoader* fxLoader = new FxTradeLoader();
@@ -58,95 +32,260 @@ std::vector<ITradeLoader*> StreamingTradeLoader::getTradeLoaders() {
     return loaders;
 }
 
+StreamingTradeLoader::StreamingTradeLoader(PricingEngineRegistry& registry) : registry_(registry) {
+}
+
 /*
- * Reuse:
- * This is the same pricing-engine setup logic as SerialPricer.
- * We reuse the config file and engine mapping.
+ * Core of Exercise 7
+ *
+ * Staged pipeline:
+ * - One loader thread per trade file pulls cursor batches of at most
+ *   batchSize_ trades and pushes them onto a bounded queue. Both files are
+ *   read concurrently, and a full queue blocks the loaders (backpressure).
+ * - pricingThreads_ workers pop batches, group each by engine, price it
+ *   with one priceBatch per engine and delete the trades straight away.
+ * - Each batch's results reach the receiver in one addResults call, made
+ *   under a lock so the receiver itself need not be thread-safe.
+ *
+ * If any stage fails the queue is closed, the remaining queued trades are
+ * freed unpriced, and the first error is rethrown once all threads exit.
+ *
+ * Cancellation is not a failure: once the token fires the loaders stop
+ * reading and close the queue, batches already loaded are reported as timed
+ * out without calling the engines, and a batch already at an engine is
+ * interrupted.
  */
-void StreamingTradeLoader::loadPricers() {
-    PricingConfigLoader loader;
-    loader.setConfigFile("./PricingConfig/PricingEngines.xml");
-    PricingEngineConfig config = loader.loadConfig();
-    
-
-    for (const auto& item : config) {
-        IPricingEngine* engine = nullptr;
-
-        std::string typeName = item.getTypeName();
-        auto dotPos = typeName.find_last_of('.');
-        if (dotPos != std::string::npos) {
-            typeName = typeName.substr(dotPos + 1);
+void StreamingTradeLoader::loadAndPrice(IScalarResultReceiver* resultReceiver,
+                                        const CancellationToken& token) {
+    if (resultReceiver == nullptr) {
+        throw std::invalid_argument("resultReceiver cannot be null");
+    }
+
+    std::vector<std::unique_ptr<ITradeLoader>> loaders;
+    for (ITradeLoader* loader : getTradeLoaders()) {
+        loaders.emplace_back(loader);
+    }
+
+    BoundedQueue<std::vector<ITrade*>> queue(queueCapacity_);
+    std::atomic<bool> failed { false };
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+    std::mutex receiverMutex;
+
+    auto fail = [&](std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failure) {
+                failure = error;
+            }
         }
+        failed = true;
+        queue.close();
+    };
 
-        if (typeName == "GovBondPricingEngine") {
-            engine = new GovBondPricingEngine();
-        } else if (typeName == "CorpBondPricingEngine") {
-            engine = new CorpBondPricingEngine();
-        } else if (typeName == "FxPricingEngine") {
-            engine = new FxPricingEngine();
-        } else {
-            throw std::runtime_error("Unknown pricing engine type: " + typeName);
+    auto deleteTrades = [](std::vector<ITrade*>& trades) {
+        for (ITrade* trade : trades) {
+            delete trade;
         }
+        trades.clear();
+    };
 
-        pricers_[item.getTradeType()] = engine;
+    // Prices (or, once cancelled, times out) one batch into the receiver.
+    auto priceBatch = [&](std::vector<ITrade*>& batch, ResultBatch& results) {
+        try {
+            priceTrades(batch, &results, token);
+            std::lock_guard<std::mutex> lock(receiverMutex);
+            results.flushTo(*resultReceiver);
+        } catch (...) {
+            results.clear();
+            fail(std::current_exception());
+        }
+    };
+
+    // Loading stage
+    std::atomic<std::size_t> loadersRunning { loaders.size() };
+    std::vector<std::thread> loaderThreads;
+    for (auto& loader : loaders) {
+        loaderThreads.emplace_back([&, source = loader.get()]() {
+            std::vector<ITrade*> batch;
+            try {
+                auto cursor = source->openCursor();
+                while (!failed && !token.isCancelled() && cursor->nextBatch(batch, batchSize_) != 0) {
+                    if (!queue.push(batch)) {
+                        break;
+                    }
+                    batch = std::vector<ITrade*>();
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+            if (token.isCancelled()) {
+                queue.close();
+            }
+            // A batch the closed queue refused was still loaded: report it.
+            if (!batch.empty() && !failed) {
+                ResultBatch results;
+                priceBatch(batch, results);
+            }
+            deleteTrades(batch);
+
+            // The last loader to finish tells the pricers no more work is coming.
+            if (loadersRunning.fetch_sub(1) == 1) {
+                queue.close();
+            }
+        });
     }
-}
 
-StreamingTradeLoader::~StreamingTradeLoader() {
-    // Clean up pricing engines
-    for (auto& p : pricers_) {
-        delete p.second;
+    // Pricing stage
+    unsigned int workerCount = pricingThreads_ != 0 ? pricingThreads_ : std::thread::hardware_concurrency();
+    workerCount = std::max(workerCount, 1u);
+    std::vector<std::thread> pricingThreads;
+    for (unsigned int w = 0; w < workerCount; ++w) {
+        pricingThreads.emplace_back([&]() {
+            std::vector<ITrade*> batch;
+            ResultBatch results;
+            while (queue.pop(batch)) {
+                if (!failed) {
+                    priceBatch(batch, results);
+                }
+
+                // Key streaming step:
+                // trades are discarded immediately after pricing
+                deleteTrades(batch);
+            }
+        });
+    }
+
+    for (auto& thread : loaderThreads) {
+        thread.join();
+    }
+    for (auto& thread : pricingThreads) {
+        thread.join();
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
     }
 }
 
 /*
- * Core of Exercise 7
+ * Follow mode
+ *
+ * Each call polls every trade file once and prices only the trades appended
+ * since the previous call, so intraday appends are priced as deltas instead
+ * of re-running the whole book. If a file was truncated or rotated its
+ * loader does a full reload and every trade in it is repriced; results for
+ * the same trade ids simply overwrite the earlier ones in the receiver.
  *
- * Reuse strategy:
- * - Reuse existing loaders to read trades
- * - Reuse pricing engines to price trades
- * - Price each trade immediately
- * - Delete trades immediately to free memory
+ * A poll commits the file offset before pricing, so trades the token timed
+ * out, or whose pricing threw, are kept per loader and priced again on the
+ * next call instead of being lost. A reload supersedes them.
+ *
+ * Returns the number of trades priced by this call.
  */
-void StreamingTradeLoader::loadAndPrice(IScalarResultReceiver* resultReceiver) {
-    loadPricers();
+std::size_t StreamingTradeLoader::followAndPrice(IScalarResultReceiver* resultReceiver,
+                                                 const CancellationToken& token) {
+    if (resultReceiver == nullptr) {
+        throw std::invalid_argument("resultReceiver cannot be null");
+    }
+    if (followers_.empty()) {
+        for (ITradeLoader* loader : getTradeLoaders()) {
+            followers_.emplace_back(loader);
+        }
+        unpriced_.resize(followers_.size());
+    }
 
-    auto loaders = getTradeLoaders();
+    std::size_t priced = 0;
+    std::vector<ITrade*> polled;
+    std::vector<ITrade*> trades;
+    ResultBatch results;
 
-    for (ITradeLoader* loader : loaders) {
-		
+    for (std::size_t i = 0; i < followers_.size(); ++i) {
+        auto* follower = dynamic_cast<ITradeFollower*>(followers_[i].get());
+        if (follower == nullptr) {
+            continue;
+        }
 
-        // Reuse existing batch interface,
-        // but process trades immediately instead of storing them.
-        auto trades = loader->loadTrades();
+        std::vector<std::unique_ptr<ITrade>>& unpriced = unpriced_[i];
+        polled.clear();
+        ITradeFollower::FollowStatus status = follower->pollTrades(polled);
+        if (status == ITradeFollower::FollowStatus::Reloaded) {
+            unpriced.clear();
+        }
+        unpriced.reserve(unpriced.size() + polled.size());
+        for (ITrade* trade : polled) {
+            unpriced.emplace_back(trade);
+        }
+        if (unpriced.empty()) {
+            continue;
+        }
 
-        for (ITrade* trade : trades) {
-			
-			// To be removed: Debug / proof of streaming: trade is handled immediately
-			//std::cout << "Streaming trade loaded: " << trade->getTradeId() << std::endl;
-			
-            //auto it = pricers_.find(trade->getType());
-            //auto it = pricers_.find(trade->getInstrument());
-            auto it = pricers_.find(trade->getTradeType());
-
-            if (it != pricers_.end()) {
-                it->second->price(trade, resultReceiver);
-            } else {
-                resultReceiver->addError(
-                    trade->getTradeId(),
-                    "No Pricing Engines available for this trade type"
-                );
-            }
+        trades.clear();
+        for (const auto& trade : unpriced) {
+            trades.push_back(trade.get());
+        }
+        priceTrades(trades, &results, token);
+        results.flushTo(*resultReceiver);
 
-            // Key streaming step:
-            // trade is discarded immediately after pricing
-            
-            //To be removed: Debug / proof of streaming: trade is released immediately
-			//std::cout << "Streaming trade released: " << trade->getTradeId() << std::endl;
+        // Reported as timed out: keep them for the next call.
+        if (token.isCancelled()) {
+            continue;
+        }
+        priced += trades.size();
+        unpriced.clear();
+    }
 
-            delete trade;
+    return priced;
+}
+
+void StreamingTradeLoader::priceTrades(const std::vector<ITrade*>& trades, IScalarResultReceiver* resultReceiver,
+                                       const CancellationToken& token) {
+    EngineBatcher batcher(registry_.getPricers());
+
+    for (ITrade* trade : trades) {
+        if (!batcher.add(trade)) {
+            resultReceiver->addError(
+                trade->getTradeId(),
+                "No Pricing Engines available for this trade type"
+            );
         }
+    }
 
-        delete loader;
+    for (const auto& engineBatch : batcher.getBatches()) {
+        if (token.isCancelled()) {
+            IPricingEngine::reportTimeouts(engineBatch.trades, resultReceiver);
+        } else {
+            engineBatch.engine->priceBatch(engineBatch.trades, resultReceiver, token);
+        }
     }
 }
+
+std::size_t StreamingTradeLoader::getBatchSize() const {
+    return batchSize_;
+}
+
+void StreamingTradeLoader::setBatchSize(std::size_t batchSize) {
+    if (batchSize == 0) {
+        throw std::invalid_argument("batchSize must be positive");
+    }
+    batchSize_ = batchSize;
+}
+
+std::size_t StreamingTradeLoader::getQueueCapacity() const {
+    return queueCapacity_;
+}
+
+void StreamingTradeLoader::setQueueCapacity(std::size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("queue capacity must be positive");
+    }
+    queueCapacity_ = capacity;
+}
+
+unsigned int StreamingTradeLoader::getPricingThreads() const {
+    return pricingThreads_;
+}
+
+void StreamingTradeLoader::setPricingThreads(unsigned int threads) {
+    pricingThreads_ = threads;
+}
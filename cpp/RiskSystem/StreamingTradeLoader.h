@@ -5,21 +5,55 @@
 #include "../Models/ITrade.h"
 #include "../Models/IScalarResultReceiver.h"
 #include "../Models/IPricingEngine.h"
+#include "../Models/Symbol.h"
+#include "../Models/CancellationToken.h"
+#include "PricingEngineRegistry.h"
+#include <memory>
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <string>
 
 class StreamingTradeLoader {
 private:
-    std::map<std::string, IPricingEngine*> pricers_;
+    PricingEngineRegistry& registry_;
+    std::size_t batchSize_ = 256;
+    std::size_t queueCapacity_ = 4;
+    unsigned int pricingThreads_ = 0;
+    std::vector<std::unique_ptr<ITradeLoader>> followers_;
+    // Per follower: trades polled but not yet priced (timed out or failed).
+    std::vector<std::vector<std::unique_ptr<ITrade>>> unpriced_;
     
     std::vector<ITradeLoader*> getTradeLoaders();
-    void loadPricers();
+    void priceTrades(const std::vector<ITrade*>& trades, IScalarResultReceiver* resultReceiver,
+                     const CancellationToken& token);
     
 public:
-    ~StreamingTradeLoader();
+    explicit StreamingTradeLoader(PricingEngineRegistry& registry = PricingEngineRegistry::instance());
     
-    void loadAndPrice(IScalarResultReceiver* resultReceiver);
+    // After the token fires the files are no longer read; trades already
+    // loaded are reported as timed out instead of being priced.
+    void loadAndPrice(IScalarResultReceiver* resultReceiver,
+                      const CancellationToken& token = CancellationToken());
+
+    // Prices only the trades appended to the trade files since the last call.
+    // Trades that time out or whose pricing throws are kept and priced again
+    // on the next call.
+    std::size_t followAndPrice(IScalarResultReceiver* resultReceiver,
+                               const CancellationToken& token = CancellationToken());
+
+    // Number of trades a loader reads before handing them to the pricers.
+    std::size_t getBatchSize() const;
+    void setBatchSize(std::size_t batchSize);
+
+    // Batches allowed to wait between the loading and pricing stages.
+    // Together with the batch size this caps trades in memory at roughly
+    // (queueCapacity + loaders + pricingThreads) * batchSize.
+    std::size_t getQueueCapacity() const;
+    void setQueueCapacity(std::size_t capacity);
+
+    // Pricing workers draining the queue; 0 uses hardware_concurrency.
+    unsigned int getPricingThreads() const;
+    void setPricingThreads(unsigned int threads);
 };
 
 #endif // STREAMINGTRADELOADER_H
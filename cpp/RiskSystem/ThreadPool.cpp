@@ -0,0 +1,115 @@
+#include "ThreadPool.h"
+
+namespace {
+    // Identifies the pool and deque of the current thread when it is a worker.
+    thread_local const void* currentPool = nullptr;
+    thread_local std::size_t currentQueue = 0;
+}
+
+ThreadPool::ThreadPool(unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    workers_.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    std::size_t index = currentPool == this
+        ? currentQueue
+        : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        ++queued_;
+        ++outstanding_;
+    }
+    workAvailable_.notify_one();
+}
+
+/*
+ * take
+ *
+ * Called only after the worker has claimed one unit of queued_, so a task
+ * is guaranteed to be in some deque; the loop just has to find it.
+ */
+std::function<void()> ThreadPool::take(std::size_t self) {
+    for (;;) {
+        {
+            WorkQueue& own = *queues_[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                std::function<void()> task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return task;
+            }
+        }
+        for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+            WorkQueue& victim = *queues_[(self + offset) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                std::function<void()> task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return task;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    currentPool = this;
+    currentQueue = index;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex_);
+            workAvailable_.wait(lock, [this]() { return queued_ > 0 || stopping_; });
+            if (queued_ == 0) {
+                return;
+            }
+            --queued_;
+        }
+
+        std::function<void()> task = take(index);
+        task();
+
+        bool nowIdle = false;
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            nowIdle = --outstanding_ == 0;
+        }
+        if (nowIdle) {
+            idle_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    idle_.wait(lock, [this]() { return outstanding_ == 0; });
+}
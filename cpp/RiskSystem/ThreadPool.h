@@ -0,0 +1,81 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*
+ * ThreadPool
+ *
+ * Fixed set of worker threads, each with its own task deque. A worker takes
+ * work from the back of its own deque and, when that is empty, steals from
+ * the front of the others. Tasks submitted from outside the pool are spread
+ * round-robin; tasks submitted by a worker go to that worker's deque.
+ * Stealing only pays off for callers that submit many uneven tasks, or
+ * submit from inside tasks. ParallelPricer does neither: it runs one
+ * long-lived dispatch loop per worker and balances through its own shared
+ * queue (BulkheadDispatcher), so it uses the pool only for its persistent
+ * threads.
+ *
+ * submit() returns a std::future for the task's result (exceptions travel
+ * through the future). waitIdle() blocks until every submitted task has
+ * finished; it must not be called from a pool thread.
+ *
+ * The destructor runs any tasks still queued, then joins the workers.
+ */
+class ThreadPool {
+public:
+    // threadCount 0 uses std::thread::hardware_concurrency (at least 1).
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& task) {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    void waitIdle();
+
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(workers_.size()); }
+
+private:
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void enqueue(std::function<void()> task);
+    std::function<void()> take(std::size_t self);
+    void workerLoop(std::size_t index);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> nextQueue_ { 0 };
+
+    // queued_ counts tasks sitting in a deque that no worker has claimed yet;
+    // outstanding_ counts tasks submitted but not yet finished.
+    std::mutex stateMutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable idle_;
+    std::size_t queued_ = 0;
+    std::size_t outstanding_ = 0;
+    bool stopping_ = false;
+};
+
+#endif // THREADPOOL_H
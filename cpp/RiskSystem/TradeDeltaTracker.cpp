@@ -0,0 +1,125 @@
+#include "TradeDeltaTracker.h"
+#include "../Models/ResultBatch.h"
+#include "../Models/TradeHasher.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+/*
+ * Receives the priced trades' results (flushed from a ResultBatch), keeps
+ * them against the hashes taken during the diff and forwards them.
+ */
+class TradeDeltaTracker::Recorder : public IScalarResultReceiver {
+public:
+    Recorder(TradeDeltaTracker& tracker, const std::unordered_map<std::string, std::uint64_t>& hashes,
+             IScalarResultReceiver& target)
+        : tracker_(tracker), hashes_(hashes), target_(target) {}
+
+    void addResult(const std::string& tradeId, double result) override {
+        target_.addResult(tradeId, result);
+    }
+
+    void addError(const std::string& tradeId, const std::string& error) override {
+        target_.addError(tradeId, error);
+    }
+
+    void addResults(std::span<const ResultRecord> records) override {
+        for (const ResultRecord& record : records) {
+            std::string tradeId(record.tradeId);
+            auto hash = hashes_.find(tradeId);
+            if (hash == hashes_.end() || record.code == ResultCode::Timeout) {
+                continue;
+            }
+            tracker_.known_.insert_or_assign(std::move(tradeId),
+                Known { hash->second, record.value, record.code, std::string(record.detail), tracker_.generation_ });
+        }
+        target_.addResults(records);
+    }
+
+private:
+    TradeDeltaTracker& tracker_;
+    const std::unordered_map<std::string, std::uint64_t>& hashes_;
+    IScalarResultReceiver& target_;
+};
+
+TradeDeltaTracker::Summary TradeDeltaTracker::reprice(const TradeContainers& tradeContainers,
+                                                      IScalarResultReceiver* resultReceiver,
+                                                      const PriceFunction& price,
+                                                      const std::string& generationToken) {
+    if (resultReceiver == nullptr) {
+        throw std::invalid_argument("resultReceiver cannot be null");
+    }
+
+    // New market or engines: nothing kept can be carried forward.
+    if (generationToken != generationToken_) {
+        known_.clear();
+        generationToken_ = generationToken;
+    }
+
+    ++generation_;
+    Summary summary;
+    TradeContainers changed(tradeContainers.size());
+    std::unordered_map<std::string, std::uint64_t> hashes;
+    std::vector<ResultRecord> carried;
+
+    for (std::size_t i = 0; i < tradeContainers.size(); ++i) {
+        for (ITrade* trade : tradeContainers[i]) {
+            if (trade == nullptr) {
+                throw std::invalid_argument("trade cannot be null");
+            }
+            std::string tradeId = trade->getTradeId();
+            std::uint64_t hash = TradeHasher::hashOf(*trade);
+            auto it = known_.find(tradeId);
+
+            if (it == known_.end()) {
+                ++summary.added;
+            } else if (it->second.hash != hash || it->second.seen == generation_) {
+                ++summary.amended;
+            } else {
+                it->second.seen = generation_;
+                carried.push_back(ResultRecord { it->first, it->second.value, it->second.code, it->second.detail });
+                ++summary.unchanged;
+                continue;
+            }
+            changed[i].push_back(trade);
+            hashes.insert_or_assign(std::move(tradeId), hash);
+        }
+    }
+
+    // Delivered before any erase below, as the records view known_ entries.
+    if (!carried.empty()) {
+        resultReceiver->addResults(carried);
+    }
+
+    // Priced trades are dropped here and re-entered by the Recorder once
+    // they have a result, so a failed run leaves them to be priced again.
+    for (auto it = known_.begin(); it != known_.end();) {
+        if (hashes.count(it->first) != 0) {
+            it = known_.erase(it);
+        } else if (it->second.seen != generation_) {
+            ++summary.removed;
+            it = known_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    std::exception_ptr failure;
+    ResultBatch results;
+    if (summary.priced() != 0) {
+        try {
+            price(changed, &results);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+    }
+    Recorder recorder(*this, hashes, *resultReceiver);
+    results.flushTo(recorder);
+
+    lastSummary_ = summary;
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+    return summary;
+}
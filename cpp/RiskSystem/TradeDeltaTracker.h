@@ -0,0 +1,85 @@
+#ifndef TRADEDELTATRACKER_H
+#define TRADEDELTATRACKER_H
+
+#include "../Models/ITrade.h"
+#include "../Models/IScalarResultReceiver.h"
+#include "../Models/ResultRecord.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * TradeDeltaTracker
+ *
+ * Remembers, per trade id, the content hash (TradeHasher) and the result of
+ * the last run, so a reloaded book can be repriced incrementally. reprice()
+ * diffs the trades against that state:
+ *
+ *   added     - id not seen before, or no result was kept for it (e.g. it
+ *               timed out last run); priced
+ *   amended   - id known but the content hash changed; priced
+ *   unchanged - same id and hash; the previous result is carried forward
+ *   removed   - known id missing from this load; forgotten
+ *
+ * The caller's receiver gets the carried-forward results first, then the
+ * results of the priced trades, so it ends up holding exactly the current
+ * book. Timeouts are passed on but not kept. Trade ids are expected to be
+ * unique within a load; a repeated id is always priced.
+ *
+ * A kept result is only as good as the market and engines that produced it,
+ * so each run names them with a generation token (see
+ * PricingEngineRegistry::getCacheTag). When the token differs from the last
+ * run's, everything kept is dropped and the whole book is priced as added.
+ *
+ * Nothing is logged; callers report the summary as they see fit (see
+ * ScreenResultPrinter::printDeltaSummary).
+ *
+ * Not thread-safe: one reprice() at a time.
+ */
+class TradeDeltaTracker {
+public:
+    struct Summary {
+        std::size_t added = 0;
+        std::size_t amended = 0;
+        std::size_t unchanged = 0;
+        std::size_t removed = 0;
+
+        std::size_t priced() const { return added + amended; }
+    };
+
+    using TradeContainers = std::vector<std::vector<ITrade*>>;
+    // Prices the given trades into the receiver (e.g. SerialPricer::price).
+    using PriceFunction = std::function<void(const TradeContainers&, IScalarResultReceiver*)>;
+
+    Summary reprice(const TradeContainers& tradeContainers, IScalarResultReceiver* resultReceiver,
+                    const PriceFunction& price, const std::string& generationToken = std::string());
+
+    // Trades with a result that the next run can carry forward.
+    std::size_t size() const { return known_.size(); }
+    void clear() { known_.clear(); }
+
+    const std::string& getGenerationToken() const { return generationToken_; }
+
+    const Summary& getLastSummary() const { return lastSummary_; }
+
+private:
+    struct Known {
+        std::uint64_t hash;
+        double value;
+        ResultCode code;
+        std::string detail;
+        std::uint64_t seen;     // generation of the last load containing the id
+    };
+
+    class Recorder;
+
+    std::unordered_map<std::string, Known> known_;
+    std::uint64_t generation_ = 0;
+    std::string generationToken_;
+    Summary lastSummary_;
+};
+
+#endif // TRADEDELTATRACKER_H
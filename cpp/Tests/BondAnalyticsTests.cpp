@@ -0,0 +1,86 @@
+#include "TestFramework.h"
+#include "../Pricers/BondAnalytics.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../Models/BondTrade.h"
+#include "../Models/ScalarResults.h"
+#include <vector>
+
+TEST(TestBondPriceFromYieldMatchesReference) {
+    BondAnalytics analytics(BondAnalytics::Terms { 4.0, 10, 2 });
+    // 20 semi-annual coupons of 2 discounted at 2.5% per period.
+    ASSERT_NEAR(analytics.priceFromYield(0.05), 92.20541885717674, 1e-10);
+    ASSERT_NEAR(analytics.priceFromYield(0.04), 100.0, 1e-10);
+
+    auto par = analytics.solve(100.0, 1000000.0);
+    ASSERT_TRUE(par.converged);
+    ASSERT_NEAR(par.yield, 0.04, 1e-12);
+}
+
+TEST(TestBatchYieldSolveMatchesScalarAndRoundTrips) {
+    BondAnalytics analytics(BondAnalytics::Terms { 5.5, 7, 2 });
+    BondAnalytics scalar(analytics.getTerms(), BondAnalytics::Isa::Scalar);
+    BondAnalytics sse2(analytics.getTerms(), BondAnalytics::Isa::Sse2);
+    // 13 trades: whole vectors plus a tail for every instruction set.
+    std::vector<double> yields;
+    std::vector<double> prices;
+    std::vector<double> notionals;
+    for (int i = 0; i < 13; ++i) {
+        yields.push_back(-0.005 + 0.01 * i);
+        prices.push_back(analytics.priceFromYield(yields.back()));
+        notionals.push_back(1000000.0 * (i + 1));
+    }
+    prices[5] = -1.0;   // not a price
+
+    std::vector<BondAnalytics::Result> results(prices.size());
+    analytics.solve(prices, notionals, results);
+    std::vector<BondAnalytics::Result> scalarResults(prices.size());
+    scalar.solve(prices, notionals, scalarResults);
+    std::vector<BondAnalytics::Result> sse2Results(prices.size());
+    sse2.solve(prices, notionals, sse2Results);
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (i == 5) {
+            ASSERT_FALSE(results[i].converged);
+            continue;
+        }
+        ASSERT_TRUE(results[i].converged);
+        ASSERT_NEAR(results[i].yield, yields[i], 1e-10);
+
+        // Every kernel does the same arithmetic, so results are bit-identical.
+        auto single = analytics.solve(prices[i], notionals[i]);
+        ASSERT_TRUE(single.yield == results[i].yield);
+        ASSERT_TRUE(single.dv01 == results[i].dv01);
+        ASSERT_TRUE(scalarResults[i].yield == results[i].yield);
+        ASSERT_TRUE(sse2Results[i].modifiedDuration == results[i].modifiedDuration);
+
+        // Modified duration against a central difference of the price.
+        double h = 1e-6;
+        double numeric = (analytics.priceFromYield(yields[i] - h) - analytics.priceFromYield(yields[i] + h))
+                         / (2.0 * h * prices[i]);
+        ASSERT_NEAR(results[i].modifiedDuration, numeric, 1e-6);
+        ASSERT_NEAR(results[i].dv01, results[i].modifiedDuration * prices[i] / 100.0 * notionals[i] * 1e-4, 1e-6);
+    }
+}
+
+TEST(TestBondEngineReportsDeterministicDv01) {
+    GovBondPricingEngine engine;
+    engine.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    BondTrade trade("GOV001");
+    trade.setNotional(1000000);
+    trade.setRate(100.0);
+    BondTrade unpriceable("GOV002");
+    std::vector<ITrade*> trades = { &trade, &unpriceable };
+
+    ScalarResults first;
+    engine.setSeed(1);
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &first);
+    ScalarResults second;
+    engine.setSeed(2);
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &second);
+
+    auto expected = BondAnalytics(engine.getTerms()).solve(100.0, 1000000.0);
+    ASSERT_NEAR(first["GOV001"]->getResult().value(), expected.dv01, 1e-9);
+    ASSERT_NEAR(second["GOV001"]->getResult().value(), expected.dv01, 1e-9);
+    ASSERT_FALSE(first["GOV002"]->getResult().has_value());
+    ASSERT_TRUE(first["GOV002"]->getError().has_value());
+}
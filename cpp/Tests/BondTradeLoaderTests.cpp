@@ -5,6 +5,9 @@
 #include <chrono>
 #include <ctime>
 #include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 
 static TradeList* tradeList = nullptr;
 
@@ -72,3 +75,210 @@ TEST(TestTradeLoadAccuracyOfLastTrade) {
     ASSERT_NEAR(trade->getRate(), 120.240, 0.001);
     ASSERT_EQ(trade->getTradeId(), "CORP003");
 }
+
+TEST(TestMemoryMappedLoadMatchesStreamLoad) {
+    BondTradeLoader streamLoader;
+    streamLoader.setDataFile("Loaders/TradeData/BondTrades.dat");
+    auto expected = streamLoader.loadTrades();
+
+    BondTradeLoader mappedLoader;
+    mappedLoader.setDataFile("Loaders/TradeData/BondTrades.dat");
+    mappedLoader.setMemoryMapped(true);
+    auto actual = mappedLoader.loadTrades();
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(actual[i]->getTradeId(), expected[i]->getTradeId());
+        ASSERT_EQ(actual[i]->getTradeType(), expected[i]->getTradeType());
+        ASSERT_TRUE(actual[i]->getTradeDate() == expected[i]->getTradeDate());
+        ASSERT_EQ(actual[i]->getInstrument(), expected[i]->getInstrument());
+        ASSERT_EQ(actual[i]->getCounterparty(), expected[i]->getCounterparty());
+        ASSERT_EQ(actual[i]->getNotional(), expected[i]->getNotional());
+        ASSERT_EQ(actual[i]->getRate(), expected[i]->getRate());
+    }
+
+    for (auto trade : expected) delete trade;
+    for (auto trade : actual) delete trade;
+}
+
+TEST(TestCursorReturnsBoundedBatchesInFileOrder) {
+    for (bool mapped : { false, true }) {
+        BondTradeLoader loader;
+        loader.setDataFile("Loaders/TradeData/BondTrades.dat");
+        loader.setMemoryMapped(mapped);
+
+        auto cursor = loader.openCursor();
+        std::vector<ITrade*> batch;
+        std::vector<size_t> batchSizes;
+        std::vector<std::string> ids;
+        while (cursor->nextBatch(batch, 3) != 0) {
+            ASSERT_TRUE(batch.size() <= 3);
+            batchSizes.push_back(batch.size());
+            for (auto trade : batch) {
+                ids.push_back(trade->getTradeId());
+                delete trade;
+            }
+            batch.clear();
+        }
+
+        ASSERT_EQ(batchSizes.size(), 4);
+        ASSERT_EQ(batchSizes[3], 1);
+        ASSERT_EQ(ids.size(), 10);
+        ASSERT_EQ(ids[0], "GOV001");
+        ASSERT_EQ(ids[9], "GOV007");
+        ASSERT_EQ(cursor->nextBatch(batch, 3), 0);
+    }
+}
+
+TEST(TestFollowModeYieldsOnlyAppendedTrades) {
+    const std::string filename = "FollowBondTrades.dat";
+    std::filesystem::copy_file("Loaders/TradeData/BondTrades.dat", filename,
+                               std::filesystem::copy_options::overwrite_existing);
+
+    BondTradeLoader loader;
+    loader.setDataFile(filename);
+    std::vector<ITrade*> trades;
+
+    // First poll is a full load of the complete lines. The sample file has no
+    // final newline, so its last row follows once the size has held steady.
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Reloaded);
+    ASSERT_EQ(trades.size(), 9);
+    for (auto trade : trades) delete trade;
+    trades.clear();
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV007");
+    delete trades[0];
+    trades.clear();
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Unchanged);
+    ASSERT_EQ(trades.size(), 0);
+
+    {
+        std::ofstream out(filename, std::ios::app | std::ios::binary);
+        out << "\nGovBond,2012-09-03,DE0001135424,BCAP,1000000,99.5,GOV008\n";
+        // Partially written record: not yet complete
+        out << "CorpBond,2012-09-04,XS01";
+    }
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV008");
+    delete trades[0];
+    trades.clear();
+
+    {
+        std::ofstream out(filename, std::ios::app | std::ios::binary);
+        out << "38717441,GS,5000000,101.0,CORP004\n";
+    }
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "CORP004");
+    ASSERT_EQ(trades[0]->getInstrument(), "XS0138717441");
+    delete trades[0];
+    trades.clear();
+
+    // Truncation forces a full reload
+    {
+        std::ofstream out(filename, std::ios::trunc | std::ios::binary);
+        out << "Type,TradeDate,Instrument,Counterparty,Notional,Rate,TradeId\n";
+        out << "GovBond,2012-04-17,DE0001117794,BCAP,674500000,105.985,GOV101\n";
+    }
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Reloaded);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV101");
+    delete trades[0];
+    trades.clear();
+
+    std::remove(filename.c_str());
+}
+
+TEST(TestFollowModeRetriesAppendedChunkThatFailsToParse) {
+    const std::string filename = "FollowBadBondTrades.dat";
+    std::filesystem::copy_file("Loaders/TradeData/BondTrades.dat", filename,
+                               std::filesystem::copy_options::overwrite_existing);
+
+    BondTradeLoader loader;
+    loader.setDataFile(filename);
+    std::vector<ITrade*> trades;
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Reloaded);
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    for (auto trade : trades) delete trade;
+    trades.clear();
+
+    const std::string good = "\nGovBond,2012-09-03,DE0001135424,BCAP,1000000,99.5,GOV008\n";
+    const std::string bad = "GovBond,2012-09-04,DE0001135432,BCAP,1000000,xx.x,GOV009\n";
+    std::uintmax_t badOffset = std::filesystem::file_size(filename) + good.size();
+    {
+        std::ofstream out(filename, std::ios::app | std::ios::binary);
+        out << good << bad;
+    }
+
+    bool threw = false;
+    try {
+        loader.pollTrades(trades);
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+    ASSERT_EQ(trades.size(), 0);
+
+    // Correct the bad row in place: both rows come back on the next poll.
+    {
+        std::fstream out(filename, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekp(static_cast<std::streamoff>(badOffset));
+        out << "GovBond,2012-09-04,DE0001135432,BCAP,1000000,98.5,GOV009\n";
+    }
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 2);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV008");
+    ASSERT_EQ(trades[1]->getTradeId(), "GOV009");
+    for (auto trade : trades) delete trade;
+    trades.clear();
+
+    std::remove(filename.c_str());
+}
+
+TEST(TestFollowModeHoldsBackALineCutOffMidWrite) {
+    const std::string filename = "FollowPartialBondTrades.dat";
+    {
+        std::ofstream out(filename, std::ios::trunc | std::ios::binary);
+        out << "Type,TradeDate,Instrument,Counterparty,Notional,Rate,TradeId\n";
+        out << "GovBond,2012-04-17,DE0001117794,BCAP,6745";
+    }
+
+    BondTradeLoader loader;
+    loader.setDataFile(filename);
+    std::vector<ITrade*> trades;
+
+    // The first poll is a reload and catches the writer mid-row.
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Reloaded);
+    ASSERT_EQ(trades.size(), 0);
+
+    {
+        std::ofstream out(filename, std::ios::app | std::ios::binary);
+        out << "00000,105.985,GOV101\n";
+        out << "GovBond,2012-04-18,DE0001135424,BCAP,1000000,99.5,GOV102";
+    }
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV101");
+    ASSERT_EQ(trades[0]->getNotional(), 674500000);
+    delete trades[0];
+    trades.clear();
+
+    // The writer has stopped without a final newline: the tail is taken.
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Appended);
+    ASSERT_EQ(trades.size(), 1);
+    ASSERT_EQ(trades[0]->getTradeId(), "GOV102");
+    delete trades[0];
+    trades.clear();
+
+    ASSERT_TRUE(loader.pollTrades(trades) == ITradeFollower::FollowStatus::Unchanged);
+    std::remove(filename.c_str());
+}
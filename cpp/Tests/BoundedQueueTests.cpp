@@ -0,0 +1,78 @@
+#include "TestFramework.h"
+#include "../RiskSystem/BoundedQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(TestBoundedQueueDeliversEveryItemAcrossProducersAndConsumers) {
+    BoundedQueue<int> queue(3);
+    const int producers = 3;
+    const int perProducer = 500;
+    std::atomic<long long> sum { 0 };
+    std::atomic<int> received { 0 };
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 2; ++c) {
+        consumers.emplace_back([&]() {
+            int item;
+            while (queue.pop(item)) {
+                sum += item;
+                ++received;
+            }
+        });
+    }
+
+    std::vector<std::thread> producerThreads;
+    for (int p = 0; p < producers; ++p) {
+        producerThreads.emplace_back([&queue]() {
+            for (int i = 1; i <= perProducer; ++i) {
+                int item = i;
+                queue.push(item);
+            }
+        });
+    }
+    for (auto& t : producerThreads) t.join();
+    queue.close();
+    for (auto& t : consumers) t.join();
+
+    ASSERT_EQ(received.load(), producers * perProducer);
+    ASSERT_EQ(sum.load(), producers * (perProducer * (perProducer + 1) / 2LL));
+}
+
+TEST(TestBoundedQueueBlocksProducerWhenFull) {
+    BoundedQueue<int> queue(2);
+    int a = 1, b = 2, c = 3;
+    ASSERT_TRUE(queue.push(a));
+    ASSERT_TRUE(queue.push(b));
+
+    std::atomic<bool> pushed { false };
+    std::thread producer([&]() {
+        queue.push(c);
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(pushed.load());
+    ASSERT_EQ(queue.size(), 2u);
+
+    int item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(item, 1);
+    producer.join();
+    ASSERT_TRUE(pushed.load());
+}
+
+TEST(TestBoundedQueueCloseRefusesPushesButDrains) {
+    BoundedQueue<int> queue(4);
+    int a = 7;
+    queue.push(a);
+    queue.close();
+
+    int b = 8;
+    ASSERT_FALSE(queue.push(b));
+    int item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(item, 7);
+    ASSERT_FALSE(queue.pop(item));
+}
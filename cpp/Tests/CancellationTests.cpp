@@ -0,0 +1,123 @@
+#include "TestFramework.h"
+#include "../Models/CancellationToken.h"
+#include "../Models/ScalarResults.h"
+#include "../Models/BondTrade.h"
+#include "../Models/FxTrade.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../Pricers/PricingEngineFactory.h"
+#include "../RiskSystem/ParallelPricer.h"
+#include "../RiskSystem/PricingEngineRegistry.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    class ThrowingPricingEngine : public IPricingEngine {
+    public:
+        void price(ITrade*, IScalarResultReceiver*) override {
+            throw std::runtime_error("backend unavailable");
+        }
+    };
+
+    PricingEngineFactory::Registrar<ThrowingPricingEngine> throwingRegistrar("ThrowingPricingEngine");
+}
+
+TEST(TestCancellationTokenInterruptsSleep) {
+    CancellationToken token;
+    ASSERT_FALSE(token.isCancelled());
+    ASSERT_TRUE(token.sleepFor(std::chrono::milliseconds(1)));
+
+    CancellationToken shared = token;
+    std::thread canceller([shared]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        shared.cancel();
+    });
+    auto started = std::chrono::steady_clock::now();
+    ASSERT_FALSE(token.sleepFor(std::chrono::seconds(30)));
+    canceller.join();
+    ASSERT_TRUE(std::chrono::steady_clock::now() - started < std::chrono::seconds(5));
+    ASSERT_TRUE(token.isCancelled());
+
+    auto deadline = CancellationToken::withTimeout(std::chrono::milliseconds(10));
+    ASSERT_TRUE(deadline.hasDeadline());
+    ASSERT_FALSE(deadline.sleepFor(std::chrono::seconds(30)));
+    ASSERT_TRUE(deadline.isCancelled());
+}
+
+TEST(TestDeadlineTimesOutBatchInFlight) {
+    GovBondPricingEngine engine;
+    BondTrade gov("GOV001");
+    FxTrade fx("FX001", FxTrade::FxSpotTradeType);
+    std::vector<ITrade*> trades = { &gov, &fx };
+
+    ScalarResults results;
+    auto token = CancellationToken::withTimeout(std::chrono::milliseconds(20));
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &results, token);
+
+    ASSERT_EQ(results.size(), 2);
+    ASSERT_FALSE(results["GOV001"]->getResult().has_value());
+    ASSERT_EQ(results["GOV001"]->getError().value(), "Pricing timed out before the trade was priced");
+    ASSERT_EQ(results["FX001"]->getError().value(), "Trade type not supported");
+}
+
+TEST(TestParallelPricerReportsTimeoutsForUndispatchedWork) {
+    BondTrade gov("GOV001");
+    BondTrade corp("CORP001", BondTrade::CorpBondTradeType);
+    FxTrade fwd("FWD001", FxTrade::FxForwardTradeType);
+    std::vector<std::vector<ITrade*>> trades = { { &gov, &corp }, { &fwd } };
+
+    CancellationToken token;
+    token.cancel();
+
+    ParallelPricer pricer;
+    pricer.setThreadCount(2);
+    ScalarResults results;
+    pricer.price(trades, &results, token);
+
+    ASSERT_EQ(results.size(), 3);
+    for (const auto& result : results) {
+        ASSERT_FALSE(result.getResult().has_value());
+        ASSERT_EQ(result.getError().value(), "Pricing timed out before the trade was priced");
+    }
+}
+
+TEST(TestParallelPricerReportsFailedBatchAsErrors) {
+    const std::string configFile = "FailingPricingEngines.xml";
+    {
+        std::ofstream out(configFile);
+        out << "<PricingEngines>\n"
+            << "  <Engine tradeType=\"GovBond\" assembly=\"A\" pricingEngine=\"ThrowingPricingEngine\" />\n"
+            << "  <Engine tradeType=\"FxSpot\" assembly=\"A\" pricingEngine=\"FxPricingEngine\" />\n"
+            << "</PricingEngines>\n";
+    }
+    PricingEngineRegistry registry(configFile);
+    dynamic_cast<BasePricingEngine&>(*registry.getPricers().at(Symbol(FxTrade::FxSpotTradeType)))
+        .setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+
+    BondTrade first("GOV001");
+    BondTrade second("GOV002");
+    FxTrade spot("FX001", FxTrade::FxSpotTradeType);
+    std::vector<std::vector<ITrade*>> trades = { { &first, &second }, { &spot } };
+
+    ParallelPricer pricer(registry);
+    pricer.setThreadCount(2);
+    ScalarResults results;
+    bool threw = false;
+    try {
+        pricer.price(trades, &results);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    // The failure still reaches the caller, but no trade is left without an outcome.
+    ASSERT_TRUE(threw);
+    ASSERT_EQ(results.size(), 3);
+    ASSERT_EQ(results["GOV001"]->getError().value(), "Pricing engine failed: backend unavailable");
+    ASSERT_EQ(results["GOV002"]->getError().value(), "Pricing engine failed: backend unavailable");
+    ASSERT_TRUE(results.containsTrade("FX001"));
+
+    std::remove(configFile.c_str());
+}
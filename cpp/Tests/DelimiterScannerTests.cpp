@@ -0,0 +1,68 @@
+#include "TestFramework.h"
+#include "../Loaders/DelimiterScanner.h"
+#include <array>
+#include <string>
+
+static const DelimiterScanner::Isa AllIsas[] = {
+    DelimiterScanner::Isa::Scalar, DelimiterScanner::Isa::Sse2, DelimiterScanner::Isa::Avx2 };
+
+TEST(TestScannerFindsSingleByteDelimiterAcrossVectorWidths) {
+    // Delimiters placed either side of the 16 and 32 byte block boundaries.
+    std::string text(100, 'x');
+    text[0] = ',';
+    text[15] = ',';
+    text[16] = ',';
+    text[31] = ',';
+    text[32] = ',';
+    text[99] = ',';
+
+    for (auto isa : AllIsas) {
+        DelimiterScanner scanner(",", isa);
+        std::size_t expected[] = { 0, 15, 16, 31, 32, 99 };
+        std::size_t pos = 0;
+        for (std::size_t e : expected) {
+            pos = scanner.findDelimiter(text, pos);
+            ASSERT_EQ(pos, e);
+            ++pos;
+        }
+        ASSERT_TRUE(scanner.findDelimiter(text, pos) == DelimiterScanner::npos);
+    }
+}
+
+TEST(TestScannerFindsTwoByteDelimiterStraddlingBlocks) {
+    // 0xC2 as the last byte of a block with 0xAC as the first byte of the next,
+    // plus lone lead bytes that must not match.
+    std::string text(80, 'y');
+    text[5] = '\xC2';
+    text[15] = '\xC2';
+    text[16] = '\xAC';
+    text[31] = '\xC2';
+    text[32] = '\xAC';
+    text[78] = '\xC2';
+    text[79] = '\xAC';
+
+    for (auto isa : AllIsas) {
+        DelimiterScanner scanner("\xC2\xAC", isa);
+        ASSERT_EQ(scanner.findDelimiter(text, 0), 15);
+        ASSERT_EQ(scanner.findDelimiter(text, 16), 31);
+        ASSERT_EQ(scanner.findDelimiter(text, 33), 78);
+        ASSERT_TRUE(scanner.findDelimiter(text, 79) == DelimiterScanner::npos);
+    }
+}
+
+TEST(TestScannerSplitsFieldsAndNewlines) {
+    std::string text = "FxSpot\xC2\xAC" "2012-10-08\xC2\xAC\xC2\xAC" "EUR\r\nnext";
+
+    for (auto isa : AllIsas) {
+        DelimiterScanner scanner("\xC2\xAC", isa);
+        std::size_t newline = scanner.findNewline(text, 0);
+        ASSERT_EQ(newline, text.find('\n'));
+
+        std::array<std::string_view, 3> items;
+        std::size_t count = scanner.split(std::string_view(text).substr(0, newline), items);
+        ASSERT_EQ(count, 4);
+        ASSERT_EQ(items[0], "FxSpot");
+        ASSERT_EQ(items[1], "2012-10-08");
+        ASSERT_EQ(items[2], "");
+    }
+}
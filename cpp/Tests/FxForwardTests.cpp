@@ -0,0 +1,101 @@
+#include "TestFramework.h"
+#include "../Pricers/DiscountCurve.h"
+#include "../Pricers/FxCurveCache.h"
+#include "../Pricers/FxPricingEngine.h"
+#include "../Models/FxTrade.h"
+#include "../Models/ScalarResults.h"
+#include "../RiskSystem/PricingEngineRegistry.h"
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(TestDiscountCurveInterpolatesLogDiscountFactors) {
+    const std::vector<double> tenors = { 1.0, 2.0 };
+    const std::vector<double> rates = { 0.02, 0.03 };
+    DiscountCurve curve(tenors, rates);
+
+    ASSERT_NEAR(curve.discount(0.0), 1.0, 0.0);
+    ASSERT_NEAR(curve.discount(1.0), std::exp(-0.02), 1e-15);
+    ASSERT_NEAR(curve.discount(2.0), std::exp(-0.06), 1e-15);
+    // Log-linear between nodes, flat forward past the last one.
+    ASSERT_NEAR(curve.discount(1.5), std::sqrt(std::exp(-0.02) * std::exp(-0.06)), 1e-15);
+    ASSERT_NEAR(curve.discount(3.0), std::exp(-0.06 - 0.04), 1e-15);
+    ASSERT_NEAR(curve.zeroRate(0.5), 0.02, 1e-15);
+}
+
+TEST(TestFxForwardsShareOneComputationPerPairAndDate) {
+    using namespace std::chrono;
+    const std::vector<double> tenors = { 1.0 };
+    auto curves = std::make_shared<FxCurveCache>(sys_days(year(2012) / 10 / 15),
+        std::unordered_map<std::string, FxCurveCache::CurrencyMarket> {
+            { "USD", { 1.0, tenors, { 0.01 } } },
+            { "EUR", { 0.8, tenors, { 0.03 } } } });
+
+    FxPricingEngine engine;
+    engine.setLatency(milliseconds(0), milliseconds(0));
+    engine.setCurveCache(curves);
+
+    std::vector<std::unique_ptr<FxTrade>> owned;
+    std::vector<ITrade*> trades;
+    for (int i = 0; i < 1000; ++i) {
+        owned.push_back(std::make_unique<FxTrade>("FWD" + std::to_string(i), FxTrade::FxForwardTradeType));
+        owned.back()->setInstrument("EURUSD");
+        owned.back()->setNotional(1000000);
+        owned.back()->setRate(1.2);
+        owned.back()->setValueDate(sys_days(year(2013) / 10 / 15));
+        trades.push_back(owned.back().get());
+    }
+    FxTrade settled("SETTLED", FxTrade::FxForwardTradeType);
+    settled.setInstrument("EURUSD");
+    settled.setValueDate(sys_days(year(2012) / 7 / 16));
+    FxTrade unknown("UNKNOWN", FxTrade::FxForwardTradeType);
+    unknown.setInstrument("EURXYZ");
+    unknown.setValueDate(sys_days(year(2013) / 10 / 15));
+    trades.push_back(&settled);
+    trades.push_back(&unknown);
+
+    ScalarResults results;
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &results);
+
+    ASSERT_EQ(curves->getForwardsComputed(), 1u);
+    ASSERT_EQ(curves->getCurvesBuilt(), 2u);
+
+    // One year: F = 1.25 * e^-0.03 / e^-0.01, discounted at the USD rate.
+    double outright = 1.25 * std::exp(-0.03) / std::exp(-0.01);
+    double expected = 1000000 * (outright - 1.2) * std::exp(-0.01);
+    ASSERT_NEAR(results["FWD0"]->getResult().value(), expected, 1e-6);
+    ASSERT_NEAR(results["FWD999"]->getResult().value(), expected, 1e-6);
+    ASSERT_FALSE(results["SETTLED"]->getResult().has_value());
+    ASSERT_FALSE(results["UNKNOWN"]->getResult().has_value());
+}
+
+TEST(TestFxMarketLoadsFromConfiguredFile) {
+    using namespace std::chrono;
+    auto loaded = FxCurveCache::load("RiskSystem/PricingConfig/FxMarket.dat");
+    auto sample = FxCurveCache::sample();
+    ASSERT_TRUE(loaded->getValuationDate() == sys_days(year(2012) / 10 / 15));
+    // The shipped file is the market the sample fixture describes.
+    ASSERT_EQ(loaded->getSnapshotId(), sample->getSnapshotId());
+
+    // An engine starts without a market; the registry injects the configured one.
+    FxPricingEngine bare;
+    ASSERT_TRUE(bare.getCurveCache() == nullptr);
+
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    auto* spot = dynamic_cast<FxPricingEngine*>(registry.getPricers().at(Symbol(FxTrade::FxSpotTradeType)));
+    auto* forward = dynamic_cast<FxPricingEngine*>(registry.getPricers().at(Symbol(FxTrade::FxForwardTradeType)));
+    ASSERT_TRUE(spot != nullptr && forward != nullptr);
+    ASSERT_TRUE(spot->getCurveCache() != nullptr);
+    ASSERT_TRUE(spot->getCurveCache() == forward->getCurveCache());
+    ASSERT_EQ(spot->getCurveCache()->getSnapshotId(), sample->getSnapshotId());
+
+    bool threw = false;
+    try {
+        FxCurveCache::load("NoSuchMarket.dat");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
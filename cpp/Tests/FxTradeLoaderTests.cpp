@@ -5,6 +5,8 @@
 #include <chrono>
 #include <ctime>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 
 static TradeList* fxTradeList = nullptr;
 
@@ -88,3 +90,90 @@ TEST(TestFxTradeLoadAccuracyOfLastTrade) {
     auto valueDiff = std::chrono::duration_cast<std::chrono::hours>(actualValueDate - expectedValueDate).count();
     ASSERT_TRUE(std::abs(valueDiff) < 24);
 }
+
+static std::string writeLargeFxFile(const std::string& filename, int rows, int footerCount) {
+    std::ofstream out(filename, std::ios::binary);
+    out << "FxTrades\xC2\xAC" "2012-10-15\r\n";
+    out << "Type\xC2\xAC" "TradeDate\xC2\xAC" "Ccy1\xC2\xAC" "Ccy2\xC2\xAC" "Amount\xC2\xAC"
+           "Rate\xC2\xAC" "ValueDate\xC2\xAC" "Counterparty\xC2\xAC" "TradeId\r\n";
+    for (int i = 0; i < rows; ++i) {
+        out << (i % 2 == 0 ? "FxSpot" : "FxFwd") << "\xC2\xAC" "2012-10-08\xC2\xAC" "EUR\xC2\xAC" "USD\xC2\xAC"
+            << (1000 + i) << "\xC2\xAC" "0.97562\xC2\xAC" "2012-10-11\xC2\xAC" "CSI,AG\xC2\xAC" "FX" << i << "\r\n";
+    }
+    out << "END\xC2\xAC" << footerCount;
+    return filename;
+}
+
+TEST(TestFxParallelLoadMatchesSerialLoad) {
+    const int rows = 20000;
+    std::string filename = writeLargeFxFile("FxTradesParallelTest.dat", rows, rows + 1);
+
+    FxTradeLoader serialLoader;
+    serialLoader.setDataFile(filename);
+    auto expected = serialLoader.loadTrades();
+
+    FxTradeLoader parallelLoader;
+    parallelLoader.setDataFile(filename);
+    parallelLoader.setParallel(true);
+    parallelLoader.setThreadCount(4);
+    auto actual = parallelLoader.loadTrades();
+
+    ASSERT_EQ(expected.size(), static_cast<size_t>(rows));
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(actual[i]->getTradeId(), expected[i]->getTradeId());
+        ASSERT_EQ(actual[i]->getTradeType(), expected[i]->getTradeType());
+        ASSERT_EQ(actual[i]->getInstrument(), expected[i]->getInstrument());
+        ASSERT_EQ(actual[i]->getCounterparty(), expected[i]->getCounterparty());
+        ASSERT_EQ(actual[i]->getNotional(), expected[i]->getNotional());
+    }
+
+    for (auto trade : expected) delete trade;
+    for (auto trade : actual) delete trade;
+    std::remove(filename.c_str());
+}
+
+TEST(TestFxParallelLoadOfFeedFile) {
+    FxTradeLoader loader;
+    loader.setDataFile("Loaders/TradeData/FxTrades.dat");
+    loader.setParallel(true);
+    auto trades = loader.loadTrades();
+
+    ASSERT_EQ(trades.size(), 4);
+    ASSERT_EQ(trades[0]->getTradeId(), "SPOT001");
+    ASSERT_EQ(trades[3]->getTradeId(), "FWD002");
+    for (auto trade : trades) delete trade;
+}
+
+TEST(TestFxParallelLoadRejectsFooterCountMismatch) {
+    std::string filename = writeLargeFxFile("FxTradesFooterTest.dat", 100, 42);
+
+    FxTradeLoader loader;
+    loader.setDataFile(filename);
+    loader.setParallel(true);
+
+    bool threw = false;
+    try {
+        loader.loadTrades();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    std::remove(filename.c_str());
+    ASSERT_TRUE(threw);
+}
+
+TEST(TestFxSerialLoadRejectsFooterCountMismatch) {
+    std::string filename = writeLargeFxFile("FxTradesSerialFooterTest.dat", 100, 42);
+
+    FxTradeLoader loader;
+    loader.setDataFile(filename);
+
+    bool threw = false;
+    try {
+        loader.loadTrades();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    std::remove(filename.c_str());
+    ASSERT_TRUE(threw);
+}
@@ -3,7 +3,10 @@
 #include "../RiskSystem/PricingEngineConfig.h"
 #include "../Models/BondTrade.h"
 #include "../Models/FxTrade.h"
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <stdexcept>
 
 static PricingEngineConfig* config = nullptr;
 
@@ -35,3 +38,39 @@ TEST(TestLastConfigMapping) {
     ASSERT_EQ(configItem.getAssembly(), "HmxLabs.TechTest.Pricers");
 }
 
+
+TEST(TestMaxConcurrencyIsOptional) {
+    setUpConfig();
+    ASSERT_EQ((*config)[0].getMaxConcurrency(), 0u);
+    ASSERT_EQ((*config)[1].getTradeType(), BondTrade::CorpBondTradeType);
+    ASSERT_EQ((*config)[1].getMaxConcurrency(), 2u);
+}
+
+TEST(TestSeedIsOptional) {
+    setUpConfig();
+    ASSERT_FALSE((*config)[0].getSeed().has_value());
+
+    const std::string configFile = "SeedConfig.xml";
+    PricingConfigLoader loader;
+    loader.setConfigFile(configFile);
+    {
+        std::ofstream out(configFile);
+        out << "<Engine tradeType=\"GovBond\" assembly=\"A\" pricingEngine=\"GovBondPricingEngine\" seed=\"42\" />\n";
+    }
+    auto seeded = loader.loadConfig();
+    ASSERT_EQ(seeded.size(), 1);
+    ASSERT_EQ(seeded[0].getSeed().value(), 42u);
+
+    {
+        std::ofstream out(configFile);
+        out << "<Engine tradeType=\"GovBond\" assembly=\"A\" pricingEngine=\"GovBondPricingEngine\" seed=\"-1\" />\n";
+    }
+    bool threw = false;
+    try {
+        loader.loadConfig();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+    std::remove(configFile.c_str());
+}
@@ -0,0 +1,70 @@
+#include "TestFramework.h"
+#include "../Pricers/PricingEngineFactory.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../Pricers/FxPricingEngine.h"
+#include "../Pricers/CorpBondPricingEngine.h"
+#include "../RiskSystem/PricingEngineRegistry.h"
+#include "../Models/BondTrade.h"
+#include "../Models/FxTrade.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+TEST(TestEnginesRegisterThemselves) {
+    auto& factory = PricingEngineFactory::instance();
+    ASSERT_TRUE(factory.isRegistered("GovBondPricingEngine"));
+    ASSERT_TRUE(factory.isRegistered("HmxLabs.TechTest.Pricers.CorpBondPricingEngine"));
+    ASSERT_FALSE(factory.isRegistered("SwapPricingEngine"));
+
+    auto engine = factory.create("HmxLabs.TechTest.Pricers.FxPricingEngine");
+    ASSERT_TRUE(dynamic_cast<FxPricingEngine*>(engine.get()) != nullptr);
+
+    bool threw = false;
+    try {
+        factory.create("SwapPricingEngine");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
+
+TEST(TestRegistryBuildsEnginesOnce) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+
+    const auto& pricers = registry.getPricers();
+    ASSERT_EQ(pricers.size(), 4);
+    IPricingEngine* gov = pricers.at(Symbol(BondTrade::GovBondTradeType));
+    ASSERT_TRUE(dynamic_cast<GovBondPricingEngine*>(gov) != nullptr);
+
+    // Each config item has its own engine, even when the class repeats.
+    ASSERT_TRUE(pricers.at(Symbol(FxTrade::FxSpotTradeType)) != pricers.at(Symbol(FxTrade::FxForwardTradeType)));
+
+    // Later calls hand back the same instances.
+    ASSERT_TRUE(&registry.getPricers() == &pricers);
+    ASSERT_TRUE(registry.getPricers().at(Symbol(BondTrade::GovBondTradeType)) == gov);
+
+    ASSERT_EQ(registry.getConcurrencyLimits().size(), 1);
+    ASSERT_EQ(registry.getConcurrencyLimits().at(pricers.at(Symbol(BondTrade::CorpBondTradeType))), 2u);
+}
+
+TEST(TestRegistrySeedsEnginesFromConfig) {
+    const std::string configFile = "SeededPricingEngines.xml";
+    {
+        std::ofstream out(configFile);
+        out << "<PricingEngines>\n"
+            << "  <Engine tradeType=\"GovBond\" assembly=\"A\" pricingEngine=\"GovBondPricingEngine\" seed=\"42\" />\n"
+            << "  <Engine tradeType=\"CorpBond\" assembly=\"A\" pricingEngine=\"CorpBondPricingEngine\" />\n"
+            << "</PricingEngines>\n";
+    }
+
+    PricingEngineRegistry registry(configFile);
+    const auto& pricers = registry.getPricers();
+    auto* gov = dynamic_cast<GovBondPricingEngine*>(pricers.at(Symbol(BondTrade::GovBondTradeType)));
+    auto* corp = dynamic_cast<CorpBondPricingEngine*>(pricers.at(Symbol(BondTrade::CorpBondTradeType)));
+    ASSERT_TRUE(gov != nullptr);
+    ASSERT_TRUE(corp != nullptr);
+    ASSERT_EQ(gov->getSeed(), 42u);
+    ASSERT_TRUE(corp->getSeed() != 42u);
+
+    std::remove(configFile.c_str());
+}
@@ -2,8 +2,28 @@
 #include "../Pricers/GovBondPricingEngine.h"
 #include "../Pricers/CorpBondPricingEngine.h"
 #include "../Pricers/FxPricingEngine.h"
+#include "../Pricers/Philox.h"
 #include "../Models/BondTrade.h"
 #include "../Models/FxTrade.h"
+#include "../Models/ScalarResults.h"
+#include "../RiskSystem/EngineBatcher.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Keeps BasePricingEngine's seeded placeholder result, which the real
+    // engines now replace with their own models.
+    class SeededPricingEngine : public BasePricingEngine {
+    public:
+        SeededPricingEngine() {
+            setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+            addSupportedTradeType(BondTrade::GovBondTradeType);
+        }
+    };
+}
 
 TEST(TestPricerTypeConfig) {
     GovBondPricingEngine govBondPricer;
@@ -17,3 +37,115 @@ TEST(TestPricerTypeConfig) {
     ASSERT_TRUE(fxPricer.isTradeTypeSupported(FxTrade::FxForwardTradeType));
 }
 
+
+TEST(TestLatencyModelChargesFixedCostOncePerBatch) {
+    GovBondPricingEngine engine;
+    ASSERT_EQ(engine.latencyFor(1).count(), 5000);
+
+    engine.setLatency(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    ASSERT_EQ(engine.latencyFor(1).count(), 110);
+    ASSERT_EQ(engine.latencyFor(20).count(), 300);
+}
+
+TEST(TestPriceBatchReportsEveryTrade) {
+    FxPricingEngine engine;
+    engine.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    engine.setCurveCache(FxCurveCache::sample());
+
+    FxTrade spot("SPOT001", FxTrade::FxSpotTradeType);
+    spot.setInstrument("EURUSD");
+    spot.setValueDate(std::chrono::sys_days(std::chrono::year(2012) / 10 / 17));
+    FxTrade warned("FWD001", FxTrade::FxForwardTradeType);
+    warned.setInstrument("USDCHF");
+    warned.setValueDate(std::chrono::sys_days(std::chrono::year(2013) / 10 / 15));
+    BondTrade bond("GOV001");
+    std::vector<ITrade*> trades = { &spot, &warned, &bond };
+
+    ScalarResults results;
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &results);
+
+    ASSERT_EQ(results.size(), 3);
+    ASSERT_TRUE(results["SPOT001"]->getResult().has_value());
+    ASSERT_FALSE(results["SPOT001"]->getError().has_value());
+    ASSERT_TRUE(results["FWD001"]->getResult().has_value());
+    ASSERT_EQ(results["FWD001"]->getError().value(), "Unable to calibrate model to value date");
+    ASSERT_FALSE(results["GOV001"]->getResult().has_value());
+    ASSERT_EQ(results["GOV001"]->getError().value(), "Trade type not supported");
+}
+
+TEST(TestEngineBatcherGroupsByEngineAndCapsBatchSize) {
+    GovBondPricingEngine gov;
+    FxPricingEngine fx;
+    std::unordered_map<Symbol, IPricingEngine*> pricers = {
+        { Symbol("GovBond"), &gov }, { Symbol("FxSpot"), &fx } };
+
+    BondTrade g1("G1"), g2("G2"), g3("G3");
+    FxTrade f1("F1");
+    BondTrade corp("C1", BondTrade::CorpBondTradeType);
+
+    EngineBatcher batcher(pricers, 2);
+    ASSERT_TRUE(batcher.add(&g1));
+    ASSERT_TRUE(batcher.add(&f1));
+    ASSERT_TRUE(batcher.add(&g2));
+    ASSERT_TRUE(batcher.add(&g3));
+    ASSERT_FALSE(batcher.add(&corp));
+
+    const auto& batches = batcher.getBatches();
+    ASSERT_EQ(batches.size(), 3);
+    ASSERT_TRUE(batches[0].engine == &gov);
+    ASSERT_EQ(batches[0].trades.size(), 2);
+    ASSERT_TRUE(batches[1].engine == &fx);
+    ASSERT_TRUE(batches[2].engine == &gov);
+    ASSERT_TRUE(batches[2].trades[0] == &g3);
+}
+
+TEST(TestPhiloxMatchesReferenceVectors) {
+    auto zero = Philox4x32::generate({ 0, 0, 0, 0 }, { 0, 0 });
+    ASSERT_EQ(zero[0], 0x6627e8d5u);
+    ASSERT_EQ(zero[3], 0x9b00dbd8u);
+
+    auto pi = Philox4x32::generate({ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 });
+    ASSERT_EQ(pi[0], 0xd16cfe09u);
+    ASSERT_EQ(pi[3], 0x24126ea1u);
+}
+
+TEST(TestSeededResultsDoNotDependOnThreading) {
+    std::vector<std::unique_ptr<BondTrade>> owned;
+    std::vector<ITrade*> trades;
+    for (int i = 0; i < 64; ++i) {
+        owned.push_back(std::make_unique<BondTrade>("G" + std::to_string(i)));
+        trades.push_back(owned.back().get());
+    }
+
+    SeededPricingEngine serial;
+    serial.setSeed(42);
+    ScalarResults expected;
+    static_cast<IPricingEngine&>(serial).priceBatch(trades, &expected);
+
+    // One shared instance, four threads, each pricing an interleaved slice.
+    SeededPricingEngine shared;
+    shared.setSeed(42);
+    std::vector<ScalarResults> perThread(4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = t; i < trades.size(); i += 4) {
+                static_cast<IPricingEngine&>(shared).price(trades[i], &perThread[t]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        const std::string& id = trades[i]->getTradeId();
+        ASSERT_EQ(perThread[i % 4][id]->getResult().value(), expected[id]->getResult().value());
+    }
+
+    SeededPricingEngine reseeded;
+    reseeded.setSeed(43);
+    ScalarResults other;
+    static_cast<IPricingEngine&>(reseeded).priceBatch(trades, &other);
+    ASSERT_TRUE(other["G0"]->getResult().value() != expected["G0"]->getResult().value());
+}
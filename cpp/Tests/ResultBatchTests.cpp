@@ -0,0 +1,92 @@
+#include "TestFramework.h"
+#include "../Models/ResultBatch.h"
+#include "../Models/ScalarResults.h"
+#include "../RiskSystem/ScreenResultPrinter.h"
+#include <sstream>
+#include <vector>
+
+// Receiver relying on the default addResults forwarding.
+class RecordingReceiver : public IScalarResultReceiver {
+public:
+    void addResult(const std::string& tradeId, double result) override {
+        calls.push_back("R:" + tradeId + ":" + std::to_string(static_cast<int>(result)));
+    }
+    void addError(const std::string& tradeId, const std::string& error) override {
+        calls.push_back("E:" + tradeId + ":" + error);
+    }
+    std::vector<std::string> calls;
+};
+
+static std::vector<ResultRecord> sampleRecords() {
+    return {
+        ResultRecord { "A", 10.0, ResultCode::Ok, "" },
+        ResultRecord { "B", 20.0, ResultCode::Warning, "stale curve" },
+        ResultRecord { "C", 0.0, ResultCode::NoPricingEngine, "" },
+    };
+}
+
+TEST(TestDefaultBatchForwardsToSingleResultMethods) {
+    RecordingReceiver receiver;
+    auto records = sampleRecords();
+    receiver.addResults(records);
+
+    ASSERT_EQ(receiver.calls.size(), 4);
+    ASSERT_EQ(receiver.calls[0], "R:A:10");
+    ASSERT_EQ(receiver.calls[1], "R:B:20");
+    ASSERT_EQ(receiver.calls[2], "E:B:stale curve");
+    ASSERT_EQ(receiver.calls[3], "E:C:No Pricing Engines available for this trade type");
+}
+
+TEST(TestScalarResultsBatchMatchesSingleCalls) {
+    auto records = sampleRecords();
+
+    ScalarResults batched;
+    batched.addResults(records);
+
+    ScalarResults single;
+    single.addResult("A", 10.0);
+    single.addResult("B", 20.0);
+    single.addError("B", "stale curve");
+    single.addError("C", "No Pricing Engines available for this trade type");
+
+    ASSERT_EQ(batched.size(), single.size());
+    for (const auto& expected : single) {
+        auto actual = batched[expected.getTradeId()];
+        ASSERT_TRUE(actual.has_value());
+        ASSERT_TRUE(actual->getResult() == expected.getResult());
+        ASSERT_TRUE(actual->getError() == expected.getError());
+    }
+}
+
+TEST(TestResultBatchFoldsWarningsAndFlushesOnce) {
+    ResultBatch batch;
+    batch.addResult("A", 1.0);
+    batch.addError("A", "warn");
+    batch.addError("B", "failed");
+    ASSERT_EQ(batch.size(), 2);
+
+    std::ostringstream out;
+    ScreenResultPrinter printer(out);
+    batch.flushTo(printer);
+
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(out.str(), "A : 1 : warn\nB : failed\n");
+}
+
+TEST(TestManySmallBatchesAddInLinearTime) {
+    // One-record batches, the way a sharded pricer or a streaming flush
+    // delivers them; exact-size reserves here made this quadratic.
+    const int count = 400000;
+    ScalarResults results;
+    ResultBatch batch;
+    for (int i = 0; i < count; ++i) {
+        std::string tradeId = "T" + std::to_string(i);
+        ResultRecord record { tradeId, static_cast<double>(i), ResultCode::Ok, "" };
+        results.addResults(std::span<const ResultRecord>(&record, 1));
+        batch.addResults(std::span<const ResultRecord>(&record, 1));
+    }
+
+    ASSERT_EQ(results.size(), count);
+    ASSERT_EQ(batch.size(), count);
+    ASSERT_NEAR(results["T399999"]->getResult().value(), 399999.0, 0.0);
+}
@@ -0,0 +1,166 @@
+#include "TestFramework.h"
+#include "../Pricers/CachingPricingEngine.h"
+#include "../Pricers/PricingResultCache.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../Pricers/FxPricingEngine.h"
+#include "../Models/FxTrade.h"
+#include "../Models/BondTrade.h"
+#include "../Models/ScalarResults.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+TEST(TestCachedEngineReplaysStoredResults) {
+    GovBondPricingEngine engine;
+    engine.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    PricingResultCache cache(4);
+    CachingPricingEngine cached(engine, "GovBond-v1", cache);
+
+    BondTrade first("GOV001");
+    first.setNotional(1000000);
+    first.setRate(101.5);
+    BondTrade second("GOV002");
+    second.setNotional(2000000);
+    second.setRate(98.25);
+    std::vector<ITrade*> trades = { &first, &second };
+
+    ScalarResults cold;
+    cached.priceBatch(trades, &cold);
+    ASSERT_EQ(cached.getMisses(), 2u);
+    ASSERT_EQ(cache.size(), 2);
+
+    ScalarResults warm;
+    cached.priceBatch(trades, &warm);
+    ASSERT_EQ(cached.getHits(), 2u);
+    ASSERT_EQ(warm.size(), 2);
+    ASSERT_NEAR(warm["GOV001"]->getResult().value(), cold["GOV001"]->getResult().value(), 0.0);
+
+    // Any priced field changing is a different key.
+    second.setNotional(2500000);
+    ScalarResults changed;
+    cached.priceBatch(trades, &changed);
+    ASSERT_EQ(cached.getHits(), 3u);
+    ASSERT_EQ(cached.getMisses(), 3u);
+
+    // So is a different engine version.
+    CachingPricingEngine upgraded(engine, "GovBond-v2", cache);
+    ScalarResults fresh;
+    upgraded.priceBatch(trades, &fresh);
+    ASSERT_EQ(upgraded.getHits(), 0u);
+    ASSERT_EQ(fresh.size(), 2);
+}
+
+TEST(TestCacheKeysSameIdTradesByTheirOwnContent) {
+    GovBondPricingEngine engine;
+    engine.setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+    PricingResultCache cache(4);
+    CachingPricingEngine cached(engine, "GovBond-v1", cache);
+
+    // Two trades sharing an id in one batch, e.g. an amendment next to the original.
+    BondTrade original("GOV001");
+    original.setNotional(1000000);
+    original.setRate(101.5);
+    BondTrade amended("GOV001");
+    amended.setNotional(3000000);
+    amended.setRate(101.5);
+    std::vector<ITrade*> trades = { &original, &amended };
+    ScalarResults batch;
+    cached.priceBatch(trades, &batch);
+    ASSERT_EQ(cache.size(), 2);
+
+    for (ITrade* trade : trades) {
+        ScalarResults expected;
+        static_cast<IPricingEngine&>(engine).priceBatch(std::vector<ITrade*> { trade }, &expected);
+        ScalarResults replayed;
+        cached.priceBatch(std::vector<ITrade*> { trade }, &replayed);
+        ASSERT_NEAR(replayed["GOV001"]->getResult().value(), expected["GOV001"]->getResult().value(), 0.0);
+    }
+    ASSERT_EQ(cached.getHits(), 2u);
+}
+
+TEST(TestEngineCacheTagSeparatesModelAndMarket) {
+    using namespace std::chrono;
+    GovBondPricingEngine gov;
+    gov.setLatency(milliseconds(0), milliseconds(0));
+    PricingResultCache cache(4);
+    CachingPricingEngine cachedGov(gov, "GovBond", cache);
+
+    BondTrade bond("GOV001");
+    bond.setNotional(1000000);
+    bond.setRate(101.5);
+    std::vector<ITrade*> bonds = { &bond };
+
+    ScalarResults results;
+    cachedGov.priceBatch(bonds, &results);
+    cachedGov.priceBatch(bonds, &results);
+    ASSERT_EQ(cachedGov.getHits(), 1u);
+
+    // The bond value does not depend on the seed, only on the terms.
+    gov.setSeed(gov.getSeed() + 1);
+    cachedGov.priceBatch(bonds, &results);
+    ASSERT_EQ(cachedGov.getHits(), 2u);
+    gov.setTerms(BondAnalytics::Terms { 4.5, 10, 2 });
+    cachedGov.priceBatch(bonds, &results);
+    ASSERT_EQ(cachedGov.getHits(), 2u);
+    ASSERT_EQ(cachedGov.getMisses(), 2u);
+
+    FxPricingEngine fx;
+    fx.setLatency(milliseconds(0), milliseconds(0));
+    CachingPricingEngine cachedFx(fx, "Fx", cache);
+    FxTrade forward("FWD001", FxTrade::FxForwardTradeType);
+    forward.setInstrument("EURUSD");
+    forward.setNotional(1000000);
+    forward.setRate(1.2);
+    forward.setValueDate(sys_days(year(2013) / 10 / 15));
+    std::vector<ITrade*> forwards = { &forward };
+
+    auto market = [](double eurRate) {
+        const std::vector<double> tenors = { 1.0 };
+        return std::make_shared<FxCurveCache>(sys_days(year(2012) / 10 / 15),
+            std::unordered_map<std::string, FxCurveCache::CurrencyMarket> {
+                { "USD", { 1.0, tenors, { 0.01 } } },
+                { "EUR", { 0.8, tenors, { eurRate } } } });
+    };
+    fx.setCurveCache(market(0.03));
+    cachedFx.priceBatch(forwards, &results);
+    // An identical snapshot built separately shares the cached results...
+    fx.setCurveCache(market(0.03));
+    cachedFx.priceBatch(forwards, &results);
+    ASSERT_EQ(cachedFx.getHits(), 1u);
+    // ...a moved market does not.
+    fx.setCurveCache(market(0.04));
+    cachedFx.priceBatch(forwards, &results);
+    ASSERT_EQ(cachedFx.getHits(), 1u);
+    ASSERT_EQ(cachedFx.getMisses(), 2u);
+}
+
+TEST(TestResultCacheSurvivesSaveAndLoad) {
+    const std::string filename = "PricingResults.cache";
+    PricingResultCache cache(4);
+    cache.store(42, PricingResultCache::Entry { 1.5, ResultCode::Ok, "" });
+    cache.store(43, PricingResultCache::Entry { 0.0, ResultCode::Error, "Unable to price" });
+    cache.save(filename);
+
+    PricingResultCache restored(8);
+    ASSERT_EQ(restored.load(filename), 2);
+    PricingResultCache::Entry entry;
+    ASSERT_TRUE(restored.find(43, entry));
+    ASSERT_TRUE(entry.code == ResultCode::Error);
+    ASSERT_EQ(entry.detail, "Unable to price");
+    ASSERT_TRUE(restored.find(42, entry));
+    ASSERT_NEAR(entry.value, 1.5, 0.0);
+
+    // A flipped byte fails the checksum and nothing is loaded.
+    {
+        std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(24);
+        file.put('\x7f');
+    }
+    PricingResultCache corrupt;
+    ASSERT_EQ(corrupt.load(filename), 0);
+    ASSERT_EQ(corrupt.size(), 0);
+    ASSERT_EQ(corrupt.load("NoSuchFile.cache"), 0);
+
+    std::remove(filename.c_str());
+}
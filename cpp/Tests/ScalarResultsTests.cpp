@@ -108,3 +108,51 @@ TEST(TestEnumeration) {
     ASSERT_EQ(dummyResult.getError().value(), DummyErrorFour);
 }
 
+
+TEST(TestEnumerationKeepsInsertionOrder) {
+    ScalarResults results;
+    results.addResult(DummyTradeIdThree, DummyResultThree);
+    results.addError(DummyTradeIdOne, DummyErrorOne);
+    results.addResult(DummyTradeIdTwo, DummyResultTwo);
+    results.addResult(DummyTradeIdOne, DummyResultOne);
+
+    std::vector<std::string> ids;
+    for (const auto& result : results) {
+        ids.push_back(result.getTradeId());
+    }
+    ASSERT_EQ(ids.size(), 3);
+    ASSERT_EQ(ids[0], DummyTradeIdThree);
+    ASSERT_EQ(ids[1], DummyTradeIdOne);
+    ASSERT_EQ(ids[2], DummyTradeIdTwo);
+
+    std::vector<std::string> sortedIds;
+    for (const auto& result : results.sorted()) {
+        sortedIds.push_back(result.getTradeId());
+    }
+    ASSERT_EQ(sortedIds[0], DummyTradeIdOne);
+    ASSERT_EQ(sortedIds[1], DummyTradeIdThree);
+    ASSERT_EQ(sortedIds[2], DummyTradeIdTwo);
+}
+
+TEST(TestManyResultsSurviveRehash) {
+    ScalarResults results;
+    const int count = 50000;
+    for (int i = 0; i < count; ++i) {
+        results.addResult("T" + std::to_string(i), i);
+    }
+    for (int i = 0; i < count; i += 7) {
+        results.addError("T" + std::to_string(i), "warn");
+    }
+
+    ASSERT_EQ(results.size(), count);
+    ASSERT_FALSE(results.containsTrade("T" + std::to_string(count)));
+
+    int index = 0;
+    for (const auto& result : results) {
+        ASSERT_EQ(result.getTradeId(), "T" + std::to_string(index));
+        ASSERT_NEAR(result.getResult().value(), index, 0.001);
+        ASSERT_EQ(result.getError().has_value(), index % 7 == 0);
+        ++index;
+    }
+    ASSERT_EQ(index, count);
+}
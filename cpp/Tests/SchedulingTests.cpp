@@ -0,0 +1,155 @@
+#include "TestFramework.h"
+#include "../RiskSystem/LptScheduler.h"
+#include "../RiskSystem/EngineCostModel.h"
+#include "../RiskSystem/BulkheadDispatcher.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../Pricers/CorpBondPricingEngine.h"
+#include "../RiskSystem/ScreenResultPrinter.h"
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST(TestLptPlanBeatsFileOrderMakespan) {
+    // In file order on two workers the 8 starts last: makespan 15.
+    std::vector<double> costs = { 2, 2, 2, 5, 5, 8 };
+    auto plan = LptScheduler::plan(costs, 2);
+
+    ASSERT_EQ(plan.order.front(), 5u);
+    ASSERT_NEAR(plan.predictedMakespan, 12.0, 1e-9);
+    ASSERT_NEAR(plan.workerLoads[0] + plan.workerLoads[1], 24.0, 1e-9);
+
+    auto single = LptScheduler::plan(costs, 1);
+    ASSERT_NEAR(single.predictedMakespan, 24.0, 1e-9);
+}
+
+TEST(TestLptPlanWaitsOnConcurrencyLimits) {
+    // Four 4s in group 0 capped at one at a time, two 1s uncapped.
+    std::vector<double> costs = { 4, 4, 4, 4, 1, 1 };
+    std::vector<std::size_t> groups = { 0, 0, 0, 0, 1, 1 };
+
+    auto unlimited = LptScheduler::plan(costs, 4, groups, { 0, 0 });
+    ASSERT_NEAR(unlimited.predictedMakespan, 5.0, 1e-9);
+    auto plain = LptScheduler::plan(costs, 4);
+    ASSERT_NEAR(plain.predictedMakespan, unlimited.predictedMakespan, 1e-9);
+
+    // Capped, the group runs back to back however many workers are free.
+    auto capped = LptScheduler::plan(costs, 4, groups, { 1, 0 });
+    ASSERT_NEAR(capped.predictedMakespan, 16.0, 1e-9);
+    ASSERT_EQ(capped.order.front(), 0u);
+    // The uncapped jobs start at once on the workers the cap leaves idle.
+    ASSERT_NEAR(capped.workerLoads[1], 1.0, 1e-9);
+}
+
+TEST(TestCostModelStartsFromEngineLatencyAndLearns) {
+    GovBondPricingEngine gov;
+    CorpBondPricingEngine corp;
+    EngineCostModel model(0.5);
+
+    ASSERT_NEAR(model.expectedCost(&gov, 1), 5000.0, 1e-9);
+    ASSERT_NEAR(model.expectedCost(&corp, 1), 8000.0, 1e-9);
+    ASSERT_TRUE(model.expectedCost(&gov, 4) < 4 * model.expectedCost(&gov, 1));
+
+    // Gov keeps running twice as slow as configured.
+    model.record(&gov, 1, 10000.0);
+    model.record(&gov, 1, 10000.0);
+    ASSERT_NEAR(model.getRatio(&gov), 2.0, 1e-9);
+    ASSERT_NEAR(model.expectedCost(&gov, 1), 10000.0, 1e-9);
+
+    model.record(&gov, 1, 5000.0);
+    ASSERT_NEAR(model.getRatio(&gov), 1.5, 1e-9);
+
+    // Another instance of the same engine class shares the estimate.
+    GovBondPricingEngine other;
+    ASSERT_NEAR(model.getRatio(&other), 1.5, 1e-9);
+    ASSERT_NEAR(model.getRatio(&corp), 1.0, 1e-9);
+}
+
+TEST(TestBulkheadSkipsSaturatedEngine) {
+    GovBondPricingEngine gov;
+    CorpBondPricingEngine corp;
+    BulkheadDispatcher dispatcher({ &corp, &corp, &gov }, { 0, 1, 2 }, { { &corp, 1 } });
+
+    std::size_t batch = 0;
+    ASSERT_TRUE(dispatcher.acquire(batch));
+    ASSERT_EQ(batch, 0u);
+
+    // Corp is at its limit, so the gov batch goes first.
+    ASSERT_TRUE(dispatcher.acquire(batch));
+    ASSERT_EQ(batch, 2u);
+
+    std::atomic<bool> acquired { false };
+    std::thread waiter([&]() {
+        std::size_t next = 0;
+        if (dispatcher.acquire(next) && next == 1) {
+            acquired = true;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(acquired.load());
+
+    dispatcher.release(0);
+    waiter.join();
+    ASSERT_TRUE(acquired.load());
+    dispatcher.release(1);
+    dispatcher.release(2);
+
+    ASSERT_FALSE(dispatcher.acquire(batch));
+    ASSERT_EQ(dispatcher.getPeakConcurrency(&corp), 1u);
+}
+
+TEST(TestBulkheadHoldsLimitUnderContention) {
+    GovBondPricingEngine gov;
+    CorpBondPricingEngine corp;
+
+    std::vector<const IPricingEngine*> engines;
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i < 40; ++i) {
+        engines.push_back(i % 4 == 0 ? static_cast<const IPricingEngine*>(&gov) : &corp);
+        order.push_back(i);
+    }
+    BulkheadDispatcher dispatcher(engines, order, { { &corp, 2 } });
+
+    std::atomic<int> running { 0 };
+    std::atomic<int> worst { 0 };
+    std::atomic<int> done { 0 };
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 6; ++w) {
+        workers.emplace_back([&]() {
+            std::size_t batch = 0;
+            while (dispatcher.acquire(batch)) {
+                if (engines[batch] == &corp) {
+                    int now = ++running;
+                    int seen = worst.load();
+                    while (now > seen && !worst.compare_exchange_weak(seen, now)) {
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    --running;
+                }
+                ++done;
+                dispatcher.release(batch);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(done.load(), 40);
+    ASSERT_TRUE(worst.load() <= 2);
+    ASSERT_EQ(dispatcher.getPeakConcurrency(&corp), 2u);
+}
+
+TEST(TestScheduleReportIsPrintedByTheCaller) {
+    ParallelPricer::ScheduleReport report;
+    report.batches = 12;
+    report.workers = 4;
+    report.predictedMakespanMs = 250;
+    report.actualMakespanMs = 262.5;
+
+    std::ostringstream out;
+    ScreenResultPrinter printer(out);
+    printer.printSchedule(report);
+    ASSERT_EQ(out.str(), "Priced 12 batches on 4 workers: predicted makespan 250 ms, actual 262.5 ms\n");
+}
@@ -0,0 +1,53 @@
+#include "TestFramework.h"
+#include "../RiskSystem/ShardedResultReceiver.h"
+#include "../Models/ScalarResults.h"
+#include <thread>
+#include <vector>
+
+TEST(TestShardedReceiverMergesAllThreads) {
+    const int threadCount = 8;
+    const int perThread = 1000;
+
+    ShardedResultReceiver receiver;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t, &receiver]() {
+            for (int i = 0; i < perThread; ++i) {
+                std::string tradeId = "T" + std::to_string(t) + "-" + std::to_string(i);
+                receiver.addResult(tradeId, i);
+                if (i % 10 == 0) {
+                    receiver.addError(tradeId, "warn");
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    ASSERT_EQ(receiver.getShardCount(), threadCount);
+
+    ScalarResults results;
+    receiver.mergeInto(results);
+    ASSERT_EQ(results.size(), threadCount * perThread);
+
+    auto result = results["T3-20"];
+    ASSERT_TRUE(result.has_value());
+    ASSERT_NEAR(result->getResult().value(), 20.0, 0.001);
+    ASSERT_EQ(result->getError().value(), "warn");
+    ASSERT_FALSE(results["T3-21"]->getError().has_value());
+}
+
+TEST(TestShardedReceiverDeliversEachEntryOnce) {
+    ShardedResultReceiver receiver;
+    receiver.addResult("A", 1.0);
+
+    ScalarResults first;
+    receiver.mergeInto(first);
+    ASSERT_EQ(first.size(), 1);
+
+    receiver.addError("B", "failed");
+    ScalarResults second;
+    receiver.mergeInto(second);
+    ASSERT_EQ(second.size(), 1);
+    ASSERT_TRUE(second.containsTrade("B"));
+    ASSERT_FALSE(second.containsTrade("A"));
+}
@@ -0,0 +1,66 @@
+#include "TestFramework.h"
+#include "../Models/VirtualClock.h"
+#include "../Models/ScalarResults.h"
+#include "../Models/BondTrade.h"
+#include "../Pricers/GovBondPricingEngine.h"
+#include "../RiskSystem/PricingEngineRegistry.h"
+#include "../RiskSystem/PricingSimulator.h"
+#include <chrono>
+#include <vector>
+
+TEST(TestVirtualClockChargesLatencyWithoutSleeping) {
+    VirtualClock clock;
+    GovBondPricingEngine engine;
+    engine.setClock(clock);
+
+    BondTrade a("GOV001"), b("GOV002"), c("GOV003");
+    std::vector<ITrade*> trades = { &a, &b, &c };
+    ScalarResults results;
+
+    auto started = std::chrono::steady_clock::now();
+    static_cast<IPricingEngine&>(engine).priceBatch(trades, &results);
+    static_cast<IPricingEngine&>(engine).price(&a, &results);
+
+    ASSERT_TRUE(std::chrono::steady_clock::now() - started < std::chrono::seconds(1));
+    ASSERT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(clock.elapsed()).count(), 7000 + 5000);
+    ASSERT_EQ(results.size(), 3);
+}
+
+TEST(TestSimulatorReplaysParallelBulkheadAndSerialModes) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    PricingSimulator simulator(registry);
+
+    Symbol corp(BondTrade::CorpBondTradeType);
+    PricingSimulator::Sources sources = { std::vector<Symbol>(48, corp), { Symbol(BondTrade::GovBondTradeType), Symbol("Swap") } };
+
+    // Three corp batches of 16 at 6000 + 16 * 2000 ms; maxConcurrency 2
+    // holds the third back even though workers are free.
+    auto parallel = simulator.simulateParallel(sources, 4, 16);
+    ASSERT_EQ(parallel.trades, 50u);
+    ASSERT_EQ(parallel.unpriced, 1u);
+    ASSERT_EQ(parallel.batches, 4u);
+    ASSERT_NEAR(parallel.makespanMs, 76000.0, 1e-6);
+    ASSERT_NEAR(parallel.maxQueueDelayMs, 38000.0, 1e-6);
+    ASSERT_EQ(parallel.engines.size(), 2u);
+    ASSERT_EQ(parallel.engines[0].label, "CorpBond");
+    ASSERT_NEAR(parallel.engines[0].utilization, 1.0, 1e-9);
+    ASSERT_NEAR(parallel.engines[1].utilization, 5000.0 / 76000.0, 1e-9);
+
+    // One batch per engine, back to back.
+    auto serial = simulator.simulateSerial(sources);
+    ASSERT_EQ(serial.batches, 2u);
+    ASSERT_NEAR(serial.makespanMs, 102000.0 + 5000.0, 1e-6);
+}
+
+TEST(TestSimulatorStreamingQueuesBehindBusyPricer) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    PricingSimulator simulator(registry);
+
+    PricingSimulator::Sources sources = { std::vector<Symbol>(3, Symbol(BondTrade::GovBondTradeType)) };
+    auto streaming = simulator.simulateStreaming(sources, 1, 1, 1, 0.0);
+
+    ASSERT_EQ(streaming.batches, 3u);
+    ASSERT_NEAR(streaming.makespanMs, 15000.0, 1e-6);
+    ASSERT_NEAR(streaming.maxQueueDelayMs, 10000.0, 1e-6);
+    ASSERT_NEAR(streaming.meanQueueDelayMs, 5000.0, 1e-6);
+}
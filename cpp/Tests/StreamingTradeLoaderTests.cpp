@@ -0,0 +1,159 @@
+#include "TestFramework.h"
+#include "../Models/CancellationToken.h"
+#include "../Models/ScalarResults.h"
+#include "../Pricers/BasePricingEngine.h"
+#include "../RiskSystem/PricingEngineRegistry.h"
+#include "../RiskSystem/StreamingTradeLoader.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // The configured engines with their simulated latency switched off.
+    void removeLatency(PricingEngineRegistry& registry) {
+        for (const auto& entry : registry.getPricers()) {
+            if (auto* engine = dynamic_cast<BasePricingEngine*>(entry.second)) {
+                engine->setLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(0));
+            }
+        }
+    }
+
+    // Cancels the run as soon as the first results arrive.
+    class CancellingReceiver : public ScalarResults {
+    public:
+        explicit CancellingReceiver(CancellationToken token) : token_(token) {}
+
+        void addResults(std::span<const ResultRecord> records) override {
+            ScalarResults::addResults(records);
+            token_.cancel();
+        }
+
+    private:
+        CancellationToken token_;
+    };
+
+    const std::string TimedOut = "Pricing timed out before the trade was priced";
+}
+
+TEST(TestStreamingLoadStopsReadingOnceCancelled) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    removeLatency(registry);
+
+    StreamingTradeLoader full(registry);
+    ScalarResults all;
+    full.loadAndPrice(&all);
+
+    CancellationToken token;
+    StreamingTradeLoader loader(registry);
+    loader.setBatchSize(1);
+    loader.setQueueCapacity(1);
+    loader.setPricingThreads(1);
+    CancellingReceiver results(token);
+    loader.loadAndPrice(&results, token);
+
+    // Only what was already loaded is reported; the rest is never read.
+    ASSERT_TRUE(results.size() >= 1);
+    ASSERT_TRUE(results.size() < all.size());
+
+    CancellationToken cancelled;
+    cancelled.cancel();
+    ScalarResults none;
+    loader.loadAndPrice(&none, cancelled);
+    ASSERT_EQ(none.size(), 0);
+}
+
+TEST(TestFollowModeRepricesTradesThatTimedOut) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    removeLatency(registry);
+    StreamingTradeLoader loader(registry);
+
+    CancellationToken cancelled;
+    cancelled.cancel();
+    ScalarResults first;
+    ASSERT_EQ(loader.followAndPrice(&first, cancelled), 0);
+    ASSERT_TRUE(first.size() > 0);
+    for (const auto& result : first) {
+        ASSERT_EQ(result.getError().value_or(""), TimedOut);
+    }
+
+    // The timed-out trades come back on the next call, with the rest of the files.
+    ScalarResults second;
+    std::size_t priced = loader.followAndPrice(&second);
+    ASSERT_TRUE(priced > first.size());
+    ASSERT_EQ(priced, second.size());
+    for (const auto& result : first) {
+        auto retried = second[result.getTradeId()];
+        ASSERT_TRUE(retried.has_value());
+        ASSERT_TRUE(retried->getError().value_or("") != TimedOut);
+    }
+
+    ScalarResults third;
+    ASSERT_EQ(loader.followAndPrice(&third), 0);
+    ASSERT_EQ(third.size(), 0);
+}
+
+TEST(TestStreamingPipelinePricesEveryTradeThroughASmallQueue) {
+    PricingEngineRegistry registry("RiskSystem/PricingConfig/PricingEngines.xml");
+    removeLatency(registry);
+
+    // One-trade batches through a one-slot queue: the loaders spend most of
+    // the run blocked on the queue, and nothing may be dropped.
+    StreamingTradeLoader loader(registry);
+    loader.setBatchSize(1);
+    loader.setQueueCapacity(1);
+    loader.setPricingThreads(2);
+    ScalarResults results;
+    loader.loadAndPrice(&results);
+
+    StreamingTradeLoader unbounded(registry);
+    ScalarResults expected;
+    unbounded.loadAndPrice(&expected);
+
+    ASSERT_TRUE(results.size() > 0);
+    ASSERT_EQ(results.size(), expected.size());
+    for (const auto& result : expected) {
+        auto actual = results[result.getTradeId()];
+        ASSERT_TRUE(actual.has_value());
+        ASSERT_TRUE(actual->getResult() == result.getResult());
+    }
+}
+
+TEST(TestStreamingPipelineRethrowsEngineFailure) {
+    const std::string configFile = "FailingStreamingEngines.xml";
+    {
+        std::ofstream out(configFile);
+        out << "<PricingEngines>\n"
+            << "  <Engine tradeType=\"GovBond\" assembly=\"A\" pricingEngine=\"ThrowingPricingEngine\" />\n"
+            << "  <Engine tradeType=\"CorpBond\" assembly=\"A\" pricingEngine=\"CorpBondPricingEngine\" />\n"
+            << "</PricingEngines>\n";
+    }
+    PricingEngineRegistry registry(configFile);
+    removeLatency(registry);
+
+    // A blocked loader on a full queue must be released when pricing fails.
+    StreamingTradeLoader loader(registry);
+    loader.setBatchSize(1);
+    loader.setQueueCapacity(1);
+    loader.setPricingThreads(1);
+    ScalarResults results;
+    std::string error;
+    try {
+        loader.loadAndPrice(&results);
+    } catch (const std::runtime_error& e) {
+        error = e.what();
+    }
+    ASSERT_EQ(error, "backend unavailable");
+
+    // The loader is reusable after a failed run.
+    std::string again;
+    try {
+        loader.loadAndPrice(&results);
+    } catch (const std::runtime_error& e) {
+        again = e.what();
+    }
+    ASSERT_EQ(again, "backend unavailable");
+
+    std::remove(configFile.c_str());
+}
@@ -0,0 +1,69 @@
+#include "TestFramework.h"
+#include "../Models/Symbol.h"
+#include "../Models/BondTrade.h"
+#include "../Models/TradeBook.h"
+#include <thread>
+#include <vector>
+
+TEST(TestSymbolInterningIsIdempotent) {
+    Symbol a("GovBond");
+    Symbol b(std::string("Gov") + "Bond");
+    Symbol c("CorpBond");
+
+    ASSERT_TRUE(a == b);
+    ASSERT_TRUE(a != c);
+    ASSERT_EQ(a.view(), "GovBond");
+    ASSERT_TRUE(Symbol().empty());
+    ASSERT_TRUE(Symbol("") == Symbol());
+}
+
+TEST(TestTradeSymbolAccessorsMatchStrings) {
+    BondTrade trade("GOV001", BondTrade::CorpBondTradeType);
+    trade.setInstrument("DE0001117794");
+    trade.setCounterparty("BCAP");
+
+    ASSERT_TRUE(trade.getTradeTypeSymbol() == Symbol("CorpBond"));
+    ASSERT_EQ(trade.getInstrumentSymbol().str(), trade.getInstrument());
+    ASSERT_EQ(trade.getCounterparty(), "BCAP");
+    ASSERT_EQ(trade.getTradeIdView(), "GOV001");
+}
+
+TEST(TestCounterpartiesDoNotGrowTheSymbolTable) {
+    BondTrade trade("GOV002", BondTrade::GovBondTradeType);
+    trade.setInstrument("DE0001117794");
+    TradeBook book;
+
+    // Counterparties are open-ended; a long follow must not fill the
+    // never-freed process-wide table with them.
+    std::size_t before = SymbolTable::instance().size();
+    for (int i = 0; i < 1000; ++i) {
+        trade.setCounterparty("counterparty-" + std::to_string(i));
+        book.add(trade);
+    }
+    book.trades()[0]->setCounterparty("renamed");
+
+    ASSERT_EQ(SymbolTable::instance().size(), before);
+    ASSERT_EQ(book[0].counterparty(), "renamed");
+    ASSERT_EQ(book[999].counterparty(), "counterparty-999");
+}
+
+TEST(TestConcurrentInterningAgreesOnIds) {
+    const int threadCount = 4;
+    const int valueCount = 2000;
+    std::vector<std::vector<std::uint32_t>> ids(threadCount, std::vector<std::uint32_t>(valueCount));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t, &ids]() {
+            for (int i = 0; i < valueCount; ++i) {
+                ids[t][i] = Symbol("concurrent-" + std::to_string(i)).id();
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (int t = 1; t < threadCount; ++t) {
+        ASSERT_TRUE(ids[t] == ids[0]);
+    }
+    ASSERT_EQ(Symbol::fromId(ids[0][1234]).view(), "concurrent-1234");
+}
@@ -0,0 +1,56 @@
+#include "TestFramework.h"
+#include "../RiskSystem/ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(TestThreadPoolRunsEverySubmittedTask) {
+    ThreadPool pool(4);
+    ASSERT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 1000; ++i) {
+        results.push_back(pool.submit([i]() { return i * 2; }));
+    }
+
+    long long sum = 0;
+    for (auto& result : results) {
+        sum += result.get();
+    }
+    ASSERT_EQ(sum, 999000LL);
+}
+
+TEST(TestThreadPoolWaitIdleCoversNestedSubmissions) {
+    ThreadPool pool(3);
+    std::atomic<int> done { 0 };
+
+    // Each outer task fans out onto its own worker's deque; idle workers
+    // have to steal those to finish.
+    for (int i = 0; i < 10; ++i) {
+        pool.submit([&pool, &done]() {
+            for (int j = 0; j < 10; ++j) {
+                pool.submit([&done]() { done.fetch_add(1); });
+            }
+            done.fetch_add(1);
+        });
+    }
+
+    pool.waitIdle();
+    ASSERT_EQ(done.load(), 110);
+}
+
+TEST(TestThreadPoolPropagatesExceptionsThroughFuture) {
+    ThreadPool pool(2);
+    auto failing = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+
+    bool thrown = false;
+    try {
+        failing.get();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+
+    // The worker survives and keeps serving tasks.
+    ASSERT_EQ(pool.submit([]() { return 7; }).get(), 7);
+}
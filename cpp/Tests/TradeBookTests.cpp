@@ -0,0 +1,109 @@
+#include "TestFramework.h"
+#include "../Loaders/BondTradeLoader.h"
+#include "../Loaders/FxTradeLoader.h"
+#include "../Models/TradeBook.h"
+#include "../Models/TradeBookTrade.h"
+#include "../Models/FxTrade.h"
+
+TEST(TestTradeBookColumnsMatchLoadedTrades) {
+    FxTradeLoader loader;
+    loader.setDataFile("Loaders/TradeData/FxTrades.dat");
+    auto trades = loader.loadTrades();
+
+    TradeBook book;
+    for (ITrade* trade : trades) {
+        book.add(*trade);
+    }
+
+    ASSERT_EQ(book.size(), trades.size());
+    for (size_t i = 0; i < trades.size(); ++i) {
+        auto fx = dynamic_cast<FxTrade*>(trades[i]);
+        TradeBook::View view = book[i];
+        ASSERT_TRUE(view.kind() == TradeBook::Kind::Fx);
+        ASSERT_EQ(std::string(view.tradeId()), trades[i]->getTradeId());
+        ASSERT_EQ(view.tradeType().str(), trades[i]->getTradeType());
+        ASSERT_EQ(view.instrument().str(), trades[i]->getInstrument());
+        ASSERT_EQ(std::string(view.counterparty()), trades[i]->getCounterparty());
+        ASSERT_EQ(book.notionals()[i], trades[i]->getNotional());
+        ASSERT_EQ(book.rates()[i], trades[i]->getRate());
+        ASSERT_TRUE(view.tradeDate() == trades[i]->getTradeDate());
+        ASSERT_TRUE(view.valueDate() == fx->getValueDate());
+    }
+
+    for (auto trade : trades) delete trade;
+}
+
+TEST(TestTradeBookInternsRepeatedStrings) {
+    BondTradeLoader loader;
+    loader.setDataFile("Loaders/TradeData/BondTrades.dat");
+    auto trades = loader.loadTrades();
+
+    TradeBook book;
+    for (ITrade* trade : trades) {
+        book.add(*trade);
+    }
+
+    // Rows with the same trade type share one symbol; distinct types do not.
+    for (size_t i = 1; i < book.size(); ++i) {
+        bool sameText = book[i].tradeType().view() == book[0].tradeType().view();
+        ASSERT_EQ(book.tradeTypes()[i] == book.tradeTypes()[0], sameText);
+    }
+    ASSERT_TRUE(book[0].kind() == TradeBook::Kind::Bond);
+    ASSERT_EQ(book[0].valueDay(), 0);
+
+    for (auto trade : trades) delete trade;
+}
+
+TEST(TestTradeBookAdaptersReadAndWriteThroughColumns) {
+    FxTrade source("FWD1", FxTrade::FxForwardTradeType);
+    source.setTradeDate(TradeBook::fromDays(15628));
+    source.setInstrument("EURUSD");
+    source.setCounterparty("Bank");
+    source.setNotional(1000.0);
+    source.setRate(1.25);
+
+    TradeBook book;
+    book.add(source);
+    book.add(source);
+
+    auto adapters = book.trades();
+    ASSERT_EQ(adapters.size(), 2);
+    ASSERT_EQ(adapters[1]->getTradeId(), "FWD1");
+    ASSERT_EQ(adapters[1]->getTradeType(), "FxFwd");
+    ASSERT_TRUE(adapters[1]->getTradeDate() == source.getTradeDate());
+
+    adapters[1]->setNotional(2500.0);
+    adapters[1]->setCounterparty("Other");
+    ASSERT_EQ(book.notionals()[1], 2500.0);
+    ASSERT_EQ(book[1].counterparty(), "Other");
+    ASSERT_EQ(book[0].counterparty(), "Bank");
+
+    // Adapters handed out earlier stay valid as the book grows.
+    book.add(source);
+    auto more = book.trades();
+    ASSERT_EQ(more.size(), 3);
+    ASSERT_TRUE(more[1] == adapters[1]);
+}
+
+TEST(TestTradeBookPacksDatesAsWholeDays) {
+    ASSERT_EQ(TradeBook::toDays(TradeBook::fromDays(15628)), 15628);
+    ASSERT_EQ(TradeBook::toDays(TradeBook::fromDays(-1)), -1);
+    ASSERT_EQ(TradeBook::toDays(TradeBook::fromDays(15628) + std::chrono::hours(23)), 15628);
+    ASSERT_EQ(TradeBook::toDays(TradeBook::fromDays(0) - std::chrono::seconds(1)), -1);
+}
+
+TEST(TestTradeBookKeepsFxKindAndValueDateThroughAdapters) {
+    FxTrade source("FWD2", FxTrade::FxForwardTradeType);
+    source.setTradeDate(TradeBook::fromDays(15628));
+    source.setValueDate(TradeBook::fromDays(15993));
+
+    TradeBook first;
+    first.add(source);
+
+    // An FX trade held through some other ITrade is still stored as FX.
+    TradeBook second;
+    second.add(*first.trades()[0]);
+    ASSERT_TRUE(second[0].kind() == TradeBook::Kind::Fx);
+    ASSERT_EQ(second[0].valueDay(), 15993);
+    ASSERT_TRUE(second.trades()[0]->getValueDate() == source.getValueDate());
+}
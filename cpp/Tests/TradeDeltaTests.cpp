@@ -0,0 +1,109 @@
+#include "TestFramework.h"
+#include "../RiskSystem/TradeDeltaTracker.h"
+#include "../Models/BondTrade.h"
+#include "../Models/ScalarResults.h"
+#include "../RiskSystem/ScreenResultPrinter.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    // Prices each trade at its notional and records which trades it saw.
+    TradeDeltaTracker::PriceFunction notionalPricer(std::vector<std::string>& priced) {
+        return [&priced](const TradeDeltaTracker::TradeContainers& containers, IScalarResultReceiver* receiver) {
+            for (const auto& container : containers) {
+                for (ITrade* trade : container) {
+                    priced.push_back(trade->getTradeId());
+                    receiver->addResult(trade->getTradeId(), trade->getNotional());
+                }
+            }
+        };
+    }
+}
+
+TEST(TestDeltaRunPricesOnlyChangedTrades) {
+    BondTrade kept("GOV001");
+    kept.setNotional(100);
+    BondTrade amended("GOV002");
+    amended.setNotional(200);
+    BondTrade dropped("CORP001", BondTrade::CorpBondTradeType);
+    dropped.setNotional(300);
+
+    TradeDeltaTracker tracker;
+    std::vector<std::string> priced;
+    ScalarResults first;
+    auto summary = tracker.reprice({ { &kept, &amended }, { &dropped } }, &first, notionalPricer(priced));
+    ASSERT_EQ(summary.added, 3);
+    ASSERT_EQ(priced.size(), 3);
+    ASSERT_EQ(tracker.size(), 3);
+
+    amended.setNotional(250);
+    BondTrade added("GOV003");
+    added.setNotional(400);
+    priced.clear();
+    ScalarResults second;
+    summary = tracker.reprice({ { &kept, &amended, &added }, {} }, &second, notionalPricer(priced));
+
+    ASSERT_EQ(summary.added, 1);
+    ASSERT_EQ(summary.amended, 1);
+    ASSERT_EQ(summary.unchanged, 1);
+    ASSERT_EQ(summary.removed, 1);
+    ASSERT_EQ(priced.size(), 2);
+    ASSERT_EQ(priced[0], "GOV002");
+    ASSERT_EQ(priced[1], "GOV003");
+
+    // The receiver holds the whole current book and nothing else.
+    ASSERT_EQ(second.size(), 3);
+    ASSERT_NEAR(second["GOV001"]->getResult().value(), 100.0, 0.0);
+    ASSERT_NEAR(second["GOV002"]->getResult().value(), 250.0, 0.0);
+    ASSERT_FALSE(second.containsTrade("CORP001"));
+    ASSERT_EQ(tracker.size(), 3);
+
+    // The run summary reports the delta sizes.
+    std::ostringstream out;
+    ScreenResultPrinter(out).printDeltaSummary(tracker.getLastSummary());
+    ASSERT_EQ(out.str(), "Delta run: 1 added, 1 amended, 1 unchanged, 1 removed\n");
+}
+
+TEST(TestDeltaRunRepricesTimedOutTrades) {
+    BondTrade trade("GOV001");
+    TradeDeltaTracker tracker;
+    int calls = 0;
+    auto timingOut = [&calls](const TradeDeltaTracker::TradeContainers& containers, IScalarResultReceiver* receiver) {
+        ++calls;
+        IPricingEngine::reportTimeouts(containers[0], receiver);
+    };
+
+    ScalarResults first;
+    tracker.reprice({ { &trade } }, &first, timingOut);
+    ASSERT_TRUE(first["GOV001"]->getError().has_value());
+    ASSERT_EQ(tracker.size(), 0);
+
+    ScalarResults second;
+    auto summary = tracker.reprice({ { &trade } }, &second, timingOut);
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(summary.added, 1);
+    ASSERT_EQ(summary.unchanged, 0);
+}
+
+TEST(TestDeltaRunRepricesEverythingForANewGeneration) {
+    BondTrade trade("GOV001");
+    trade.setNotional(100);
+    TradeDeltaTracker tracker;
+    std::vector<std::string> priced;
+
+    ScalarResults first;
+    tracker.reprice({ { &trade } }, &first, notionalPricer(priced), "market-1");
+    ScalarResults second;
+    auto summary = tracker.reprice({ { &trade } }, &second, notionalPricer(priced), "market-1");
+    ASSERT_EQ(summary.unchanged, 1);
+    ASSERT_EQ(priced.size(), 1);
+
+    // Same trade, new market: the kept result no longer applies.
+    ScalarResults third;
+    summary = tracker.reprice({ { &trade } }, &third, notionalPricer(priced), "market-2");
+    ASSERT_EQ(summary.added, 1);
+    ASSERT_EQ(summary.unchanged, 0);
+    ASSERT_EQ(priced.size(), 2);
+    ASSERT_EQ(tracker.getGenerationToken(), "market-2");
+}
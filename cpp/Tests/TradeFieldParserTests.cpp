@@ -0,0 +1,48 @@
+#include "TestFramework.h"
+#include "../Loaders/TradeFieldParser.h"
+#include <chrono>
+
+static long long daysSinceEpoch(std::chrono::system_clock::time_point tp) {
+    return std::chrono::duration_cast<std::chrono::hours>(tp.time_since_epoch()).count() / 24;
+}
+
+TEST(TestParseDateIsMidnightUtc) {
+    auto epoch = TradeFieldParser::parseDate("1970-01-01");
+    ASSERT_EQ(epoch.time_since_epoch().count(), 0);
+
+    // 2012-04-17 00:00:00 UTC
+    auto date = TradeFieldParser::parseDate("2012-04-17");
+    ASSERT_EQ(std::chrono::duration_cast<std::chrono::seconds>(date.time_since_epoch()).count(), 1334620800LL);
+
+    // Leap day and a date beyond 2038
+    ASSERT_EQ(daysSinceEpoch(TradeFieldParser::parseDate("2012-02-29")), 15399);
+    ASSERT_EQ(daysSinceEpoch(TradeFieldParser::parseDate("2112-10-15")), 52152);
+}
+
+TEST(TestParseDateRejectsMalformedInput) {
+    const char* invalid[] = { "", "2012-4-17", "2012/04/17", "2011-02-29", "2012-13-01", "2012-04-31", "20120417xx" };
+    for (const char* text : invalid) {
+        bool threw = false;
+        try {
+            TradeFieldParser::parseDate(text);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        ASSERT_TRUE(threw);
+    }
+}
+
+TEST(TestParseDouble) {
+    ASSERT_EQ(TradeFieldParser::parseDouble("674500000"), 674500000.0);
+    ASSERT_EQ(TradeFieldParser::parseDouble("105.985"), 105.985);
+    ASSERT_EQ(TradeFieldParser::parseDouble(" +0.97562\r"), 0.97562);
+    ASSERT_EQ(TradeFieldParser::parseDouble("-1.5"), -1.5);
+
+    bool threw = false;
+    try {
+        TradeFieldParser::parseDouble("12abc");
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    ASSERT_TRUE(threw);
+}
@@ -0,0 +1,192 @@
+#include "TestFramework.h"
+#include "../Loaders/BondTradeLoader.h"
+#include "../Loaders/FxTradeLoader.h"
+#include "../Loaders/SnapshotTradeLoader.h"
+#include "../Loaders/SnapshottingTradeLoader.h"
+#include "../Models/FxTrade.h"
+#include "../Models/TradeBook.h"
+#include "../Loaders/TradeSnapshot.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+static void copyFile(const std::string& from, const std::string& to) {
+    std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing);
+}
+
+static void assertSameTrades(const std::vector<ITrade*>& actual, const std::vector<ITrade*>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(actual[i]->getTradeId(), expected[i]->getTradeId());
+        ASSERT_EQ(actual[i]->getTradeType(), expected[i]->getTradeType());
+        ASSERT_TRUE(actual[i]->getTradeDate() == expected[i]->getTradeDate());
+        ASSERT_EQ(actual[i]->getInstrument(), expected[i]->getInstrument());
+        ASSERT_EQ(actual[i]->getCounterparty(), expected[i]->getCounterparty());
+        ASSERT_EQ(actual[i]->getNotional(), expected[i]->getNotional());
+        ASSERT_EQ(actual[i]->getRate(), expected[i]->getRate());
+
+        auto expectedFx = dynamic_cast<FxTrade*>(expected[i]);
+        auto actualFx = dynamic_cast<FxTrade*>(actual[i]);
+        ASSERT_EQ(actualFx != nullptr, expectedFx != nullptr);
+        if (expectedFx != nullptr) {
+            ASSERT_TRUE(actualFx->getValueDate() == expectedFx->getValueDate());
+        }
+    }
+}
+
+static void removeFiles(const std::string& dataFile) {
+    std::remove(dataFile.c_str());
+    std::remove((dataFile + ".snapshot").c_str());
+}
+
+static void deleteTrades(std::vector<ITrade*>& trades) {
+    for (auto trade : trades) delete trade;
+    trades.clear();
+}
+
+TEST(TestSnapshotRoundTripBondAndFx) {
+    copyFile("Loaders/TradeData/BondTrades.dat", "SnapshotBondTrades.dat");
+    copyFile("Loaders/TradeData/FxTrades.dat", "SnapshotFxTrades.dat");
+    std::remove("SnapshotBondTrades.dat.snapshot");
+    std::remove("SnapshotFxTrades.dat.snapshot");
+
+    auto bondText = std::make_unique<BondTradeLoader>();
+    bondText->setDataFile("SnapshotBondTrades.dat");
+    auto expectedBonds = bondText->loadTrades();
+    SnapshotTradeLoader bondLoader(std::move(bondText));
+
+    auto fxText = std::make_unique<FxTradeLoader>();
+    fxText->setDataFile("SnapshotFxTrades.dat");
+    auto expectedFx = fxText->loadTrades();
+    SnapshotTradeLoader fxLoader(std::move(fxText));
+
+    // First load parses the text and writes the snapshot
+    auto bonds = bondLoader.loadTrades();
+    ASSERT_FALSE(bondLoader.lastLoadFromSnapshot());
+    assertSameTrades(bonds, expectedBonds);
+    deleteTrades(bonds);
+
+    auto fx = fxLoader.loadTrades();
+    ASSERT_FALSE(fxLoader.lastLoadFromSnapshot());
+    deleteTrades(fx);
+
+    // Second load is served from the snapshot
+    bonds = bondLoader.loadTrades();
+    ASSERT_TRUE(bondLoader.lastLoadFromSnapshot());
+    assertSameTrades(bonds, expectedBonds);
+
+    fx = fxLoader.loadTrades();
+    ASSERT_TRUE(fxLoader.lastLoadFromSnapshot());
+    assertSameTrades(fx, expectedFx);
+
+    deleteTrades(bonds);
+    deleteTrades(fx);
+    deleteTrades(expectedBonds);
+    deleteTrades(expectedFx);
+    removeFiles("SnapshotBondTrades.dat");
+    removeFiles("SnapshotFxTrades.dat");
+}
+
+TEST(TestStaleSnapshotFallsBackToText) {
+    copyFile("Loaders/TradeData/BondTrades.dat", "StaleBondTrades.dat");
+    std::remove("StaleBondTrades.dat.snapshot");
+
+    auto text = std::make_unique<BondTradeLoader>();
+    text->setDataFile("StaleBondTrades.dat");
+    SnapshotTradeLoader loader(std::move(text));
+
+    auto trades = loader.loadTrades();
+    deleteTrades(trades);
+
+    // Append a trade: the snapshot no longer describes the file
+    {
+        std::ofstream out("StaleBondTrades.dat", std::ios::app | std::ios::binary);
+        out << "\nGovBond,2012-09-03,DE0001135424,BCAP,1000000,99.5,GOV008";
+    }
+
+    trades = loader.loadTrades();
+    ASSERT_FALSE(loader.lastLoadFromSnapshot());
+    ASSERT_EQ(trades.size(), 11);
+    ASSERT_EQ(trades[10]->getTradeId(), "GOV008");
+    deleteTrades(trades);
+
+    // The fallback rewrote the snapshot for the new contents
+    trades = loader.loadTrades();
+    ASSERT_TRUE(loader.lastLoadFromSnapshot());
+    ASSERT_EQ(trades.size(), 11);
+    deleteTrades(trades);
+    removeFiles("StaleBondTrades.dat");
+}
+
+TEST(TestCorruptSnapshotHeaderFallsBackToText) {
+    copyFile("Loaders/TradeData/BondTrades.dat", "CorruptBondTrades.dat");
+    std::remove("CorruptBondTrades.dat.snapshot");
+
+    auto text = std::make_unique<BondTradeLoader>();
+    text->setDataFile("CorruptBondTrades.dat");
+    SnapshotTradeLoader loader(std::move(text));
+
+    auto trades = loader.loadTrades();
+    deleteTrades(trades);
+
+    // Flip a byte inside the header's row count
+    {
+        std::fstream snap("CorruptBondTrades.dat.snapshot", std::ios::in | std::ios::out | std::ios::binary);
+        snap.seekp(32);
+        snap.put('\x7f');
+    }
+
+    trades = loader.loadTrades();
+    ASSERT_FALSE(loader.lastLoadFromSnapshot());
+    ASSERT_EQ(trades.size(), 10);
+    deleteTrades(trades);
+    removeFiles("CorruptBondTrades.dat");
+}
+
+TEST(TestUnwritableSnapshotDoesNotFailTheLoad) {
+    const std::string snapshotFile = "NoSuchSnapshotDir/BondTrades.dat.snapshot";
+    std::filesystem::remove_all("NoSuchSnapshotDir");
+
+    auto text = std::make_unique<BondTradeLoader>();
+    text->setDataFile("Loaders/TradeData/BondTrades.dat");
+    SnapshottingTradeLoader loader(std::move(text));
+    loader.setSnapshotFile(snapshotFile);
+
+    auto trades = loader.loadTrades();
+    ASSERT_EQ(trades.size(), 10);
+    deleteTrades(trades);
+
+    auto cursor = loader.openCursor();
+    std::size_t total = 0;
+    std::size_t count = 0;
+    while ((count = cursor->nextBatch(trades, 4)) > 0) {
+        total += count;
+        deleteTrades(trades);
+    }
+    ASSERT_EQ(total, 10);
+    ASSERT_FALSE(std::filesystem::exists(snapshotFile));
+}
+
+TEST(TestSnapshotKeepsFxTradesHeldThroughAdapters) {
+    FxTrade source("FWD3", FxTrade::FxForwardTradeType);
+    source.setInstrument("EURUSD");
+    source.setValueDate(TradeBook::fromDays(15993));
+    TradeBook book;
+    book.add(source);
+
+    const std::string snapshotFile = "AdapterTrades.snapshot";
+    TradeSnapshot::SourceStamp stamp;
+    stamp.size = 1;
+    TradeSnapshotBuilder builder;
+    builder.add(*book.trades()[0]);
+    builder.write(snapshotFile, stamp);
+
+    TradeSnapshotReader reader(snapshotFile, stamp);
+    ASSERT_TRUE(reader.isValid());
+    std::unique_ptr<ITrade> trade(reader.createTrade(0));
+    ASSERT_TRUE(dynamic_cast<FxTrade*>(trade.get()) != nullptr);
+    ASSERT_TRUE(trade->getValueDate() == source.getValueDate());
+
+    std::remove(snapshotFile.c_str());
+}
@@ -5,6 +5,24 @@
 #include "PricingConfigLoaderTests.cpp"
 #include "PricingEngineTests.cpp"
 #include "ScalarResultsTests.cpp"
+#include "DelimiterScannerTests.cpp"
+#include "TradeFieldParserTests.cpp"
+#include "TradeSnapshotTests.cpp"
+#include "TradeBookTests.cpp"
+#include "SymbolTableTests.cpp"
+#include "ShardedResultReceiverTests.cpp"
+#include "ResultBatchTests.cpp"
+#include "ThreadPoolTests.cpp"
+#include "SchedulingTests.cpp"
+#include "BoundedQueueTests.cpp"
+#include "CancellationTests.cpp"
+#include "PricingEngineRegistryTests.cpp"
+#include "SimulationTests.cpp"
+#include "ResultCacheTests.cpp"
+#include "TradeDeltaTests.cpp"
+#include "BondAnalyticsTests.cpp"
+#include "FxForwardTests.cpp"
+#include "StreamingTradeLoaderTests.cpp"
 
 int main() {
     TestRunner::runAll();